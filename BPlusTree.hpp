@@ -0,0 +1,1025 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 15:40 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BPLUSTREE_HPP
+# define BPLUSTREE_HPP
+
+#include "BPlusTreeIterator.hpp"
+#include "pairs.hpp"
+#include "MergeSort.hpp"
+
+#include <memory>
+#include <functional>
+
+namespace ft
+{
+	/* B+ tree storing values with UNIQUE keys, same Key / KeyOfValue / Compare idea as RedBlackTree.
+	   Values only live in leaves, inner nodes only hold separator keys to find the right leaf.
+	   Nodes are a few cache lines wide, so a lookup touches a handful of nodes instead of one node per level,
+	   and leaves are linked together so iterating is mostly walking arrays.
+
+	   Unlike RedBlackTree, values move around when leaves split / merge, so insert and erase invalidate iterators */
+	template <class Key, class T, class KeyOfValue, class Compare = std::less<Key>, class Allocator = std::allocator<T> >
+	class BPlusTree
+	{
+		private:
+			typedef BPlusTree<Key, T, KeyOfValue, Compare, Allocator> self_type;
+
+		public:
+			typedef Key											key_type;
+			typedef T											value_type;
+			typedef Allocator									allocator_type;
+			typedef Compare										key_compare;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+			typedef BPlusTreeIterator<self_type, false>	iterator;
+			typedef BPlusTreeIterator<self_type, true>	const_iterator;
+
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+			// Nodes are about 4 cache lines, but always hold at least 8 values / keys so that splits and merges make sense
+			static const size_type nodeBytes = 256;
+			static const size_type leafCapacity = (sizeof(value_type) * 8 <= nodeBytes) ? nodeBytes / sizeof(value_type) : 8;
+			static const size_type innerCapacity = ((sizeof(key_type) + sizeof(void*)) * 8 <= nodeBytes)
+												   ? nodeBytes / (sizeof(key_type) + sizeof(void*)) : 8;
+
+			// Under this, a node (other than the root) borrows from or merges with a sibling
+			static const size_type minLeaf = leafCapacity / 2;
+			static const size_type minInner = innerCapacity / 2;
+
+			struct node_base
+			{
+				bool			isLeaf;
+				unsigned short	count; // Values in a leaf, keys in an inner node (which has count + 1 children)
+			};
+
+			/* Values and keys may not be default constructible (eg. pair<const Key, T>), so nodes only hold raw memory
+			   for them, constructed / destroyed one by one. The union is only there to align the array.
+			   Both have room for one more than their capacity, so we can insert first and split after */
+			union value_storage
+			{
+				char		raw[(leafCapacity + 1) * sizeof(value_type)];
+				long double	alignLongDouble;
+				long		alignLong;
+				void*		alignPointer;
+			};
+
+			union key_storage
+			{
+				char		raw[(innerCapacity + 1) * sizeof(key_type)];
+				long double	alignLongDouble;
+				long		alignLong;
+				void*		alignPointer;
+			};
+
+			struct leaf_node : public node_base
+			{
+				leaf_node*		prev;
+				leaf_node*		next;
+				value_storage	values;
+			};
+
+			struct inner_node : public node_base
+			{
+				node_base*	children[innerCapacity + 2];
+				key_storage	keys; // keys[i] goes after everything in children[i] and not after anything in children[i + 1]
+			};
+
+			typedef leaf_node*	leaf_pointer;
+			typedef inner_node*	inner_pointer;
+
+			// Inner nodes met on the way down to a leaf and which child we took in each, so splits / merges can go back up
+			// Inner nodes have at least 2 children, and at least minInner + 1 below the root, so 32 levels is plenty
+			static const size_type maxDepth = 32;
+
+			struct path_type
+			{
+				inner_pointer	nodes[maxDepth];
+				size_type		slots[maxDepth];
+				size_type		depth;
+			};
+
+			// Where a key goes, filled by searchInsertPosition for insertAt
+			struct insert_position
+			{
+				path_type		path;
+				leaf_pointer	leaf;
+				size_type		idx;
+			};
+
+		private:
+			typedef typename allocator_type::template rebind<leaf_node>::other	leaf_allocator_type;
+			typedef typename allocator_type::template rebind<inner_node>::other	inner_allocator_type;
+			typedef typename allocator_type::template rebind<key_type>::other	key_allocator_type;
+
+			allocator_type			_alloc; // To construct T
+			leaf_allocator_type		_leafAlloc;
+			inner_allocator_type	_innerAlloc;
+			key_allocator_type		_keyAlloc; // To construct separator keys
+			key_compare				_comp;
+
+			node_base*		_root; // Always there, an empty leaf when the tree is empty
+			leaf_pointer	_first; // First and last leaves, for begin() / end()
+			leaf_pointer	_last;
+			size_type		_size;
+			size_type		_height; // Levels of inner nodes above the leaves
+
+		public:
+			static value_type* values(leaf_pointer leaf) { return (reinterpret_cast<value_type*>(leaf->values.raw)); }
+			static value_type& valueAt(leaf_pointer leaf, size_type idx) { return (values(leaf)[idx]); }
+
+		private:
+			static key_type* keys(inner_pointer node) { return (reinterpret_cast<key_type*>(node->keys.raw)); }
+			static const key_type& keyOf(const value_type& val) { return (KeyOfValue()(val)); }
+
+			/********** Nodes **********/
+
+			leaf_pointer createLeaf()
+			{
+				leaf_pointer leaf = this->_leafAlloc.allocate(1);
+
+				leaf->isLeaf = true;
+				leaf->count = 0;
+				leaf->prev = NULL;
+				leaf->next = NULL;
+				return (leaf);
+			}
+
+			inner_pointer createInner()
+			{
+				inner_pointer node = this->_innerAlloc.allocate(1);
+
+				node->isLeaf = false;
+				node->count = 0;
+				return (node);
+			}
+
+			void deleteLeaf(leaf_pointer leaf)
+			{
+				for (size_type i = 0; i < leaf->count; ++i)
+					this->_alloc.destroy(values(leaf) + i);
+				this->_leafAlloc.deallocate(leaf, 1);
+			}
+
+			void deleteInner(inner_pointer node)
+			{
+				for (size_type i = 0; i < node->count; ++i)
+					this->_keyAlloc.destroy(keys(node) + i);
+				this->_innerAlloc.deallocate(node, 1);
+			}
+
+			// Recursion depth is the height, so only a few levels
+			void deleteSubtree(node_base* node)
+			{
+				if (node->isLeaf)
+					return (this->deleteLeaf(static_cast<leaf_pointer>(node)));
+
+				inner_pointer inner = static_cast<inner_pointer>(node);
+				for (size_type i = 0; i <= inner->count; ++i)
+					this->deleteSubtree(inner->children[i]);
+				this->deleteInner(inner);
+			}
+
+			void resetRoot()
+			{
+				this->_first = this->createLeaf();
+				this->_last = this->_first;
+				this->_root = this->_first;
+				this->_size = 0;
+				this->_height = 0;
+			}
+
+			/********** Moving values / keys around, nothing is default constructed or assigned **********/
+
+			// Make room for by values at idx, values after idx move by slots right (count is not updated)
+			void shiftValuesRight(leaf_pointer leaf, size_type idx, size_type by = 1)
+			{
+				value_type* vals = values(leaf);
+
+				for (size_type i = leaf->count; i > idx; --i)
+				{
+					this->_alloc.construct(vals + i - 1 + by, vals[i - 1]);
+					this->_alloc.destroy(vals + i - 1);
+				}
+			}
+
+			// Fill the hole of by values at idx (already destroyed), values after it move by slots left (count is not updated)
+			void shiftValuesLeft(leaf_pointer leaf, size_type idx, size_type by = 1)
+			{
+				value_type* vals = values(leaf);
+
+				for (size_type i = idx; i + by < leaf->count; ++i)
+				{
+					this->_alloc.construct(vals + i, vals[i + by]);
+					this->_alloc.destroy(vals + i + by);
+				}
+			}
+
+			void insertInLeaf(leaf_pointer leaf, size_type idx, const value_type& val)
+			{
+				this->shiftValuesRight(leaf, idx);
+				this->_alloc.construct(values(leaf) + idx, val);
+				++leaf->count;
+			}
+
+			void removeFromLeaf(leaf_pointer leaf, size_type idx)
+			{
+				this->_alloc.destroy(values(leaf) + idx);
+				this->shiftValuesLeft(leaf, idx);
+				--leaf->count;
+			}
+
+			// Append the values of src from idx to it's end to dst, src keeps what's before idx
+			void moveValues(leaf_pointer src, size_type idx, leaf_pointer dst)
+			{
+				for (size_type i = idx; i < src->count; ++i)
+				{
+					this->_alloc.construct(values(dst) + dst->count++, values(src)[i]);
+					this->_alloc.destroy(values(src) + i);
+				}
+				src->count = idx;
+			}
+
+			// Insert key at keys[idx] and child at children[idx + 1]
+			void insertInInner(inner_pointer node, size_type idx, const key_type& key, node_base* child)
+			{
+				key_type* k = keys(node);
+
+				for (size_type i = node->count; i > idx; --i)
+				{
+					this->_keyAlloc.construct(k + i, k[i - 1]);
+					this->_keyAlloc.destroy(k + i - 1);
+					node->children[i + 1] = node->children[i];
+				}
+				this->_keyAlloc.construct(k + idx, key);
+				node->children[idx + 1] = child;
+				++node->count;
+			}
+
+			// Remove keys[keyIdx] and children[childIdx], (childIdx is keyIdx or keyIdx + 1)
+			void removeFromInner(inner_pointer node, size_type keyIdx, size_type childIdx)
+			{
+				key_type* k = keys(node);
+
+				this->_keyAlloc.destroy(k + keyIdx);
+				for (size_type i = keyIdx; i + 1 < node->count; ++i)
+				{
+					this->_keyAlloc.construct(k + i, k[i + 1]);
+					this->_keyAlloc.destroy(k + i + 1);
+				}
+				for (size_type i = childIdx; i < node->count; ++i)
+					node->children[i] = node->children[i + 1];
+				--node->count;
+			}
+
+			void setKey(inner_pointer node, size_type idx, const key_type& key)
+			{
+				this->_keyAlloc.destroy(keys(node) + idx);
+				this->_keyAlloc.construct(keys(node) + idx, key);
+			}
+
+			/********** Searching **********/
+
+			// Child to follow for key, the first one whose separator goes after key
+			size_type childIndex(inner_pointer node, const key_type& key) const
+			{
+				const key_type* k = keys(node);
+				size_type lo = 0;
+				size_type hi = node->count;
+
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(key, k[mid]))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo);
+			}
+
+			// First value of leaf not going before key
+			size_type leafLowerBound(leaf_pointer leaf, const key_type& key) const
+			{
+				const value_type* vals = values(leaf);
+				size_type lo = 0;
+				size_type hi = leaf->count;
+
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(keyOf(vals[mid]), key))
+						lo = mid + 1;
+					else
+						hi = mid;
+				}
+				return (lo);
+			}
+
+			// First value of leaf going after key
+			size_type leafUpperBound(leaf_pointer leaf, const key_type& key) const
+			{
+				const value_type* vals = values(leaf);
+				size_type lo = 0;
+				size_type hi = leaf->count;
+
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(key, keyOf(vals[mid])))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo);
+			}
+
+			// Leaf where key is (or would be), remembers the way down in path if asked
+			leaf_pointer descend(const key_type& key, path_type* path) const
+			{
+				node_base* curr = this->_root;
+
+				if (path != NULL)
+					path->depth = 0;
+				while (!curr->isLeaf)
+				{
+					inner_pointer inner = static_cast<inner_pointer>(curr);
+					size_type slot = this->childIndex(inner, key);
+
+					if (path != NULL)
+					{
+						path->nodes[path->depth] = inner;
+						path->slots[path->depth] = slot;
+						++path->depth;
+					}
+					curr = inner->children[slot];
+				}
+				return (static_cast<leaf_pointer>(curr));
+			}
+
+			// Position past the end of a leaf is the first value of the next one (or end() for the last leaf)
+			iterator normalize(leaf_pointer leaf, size_type idx) const
+			{
+				if (idx == leaf->count && leaf->next != NULL)
+					return (iterator(leaf->next, 0));
+				return (iterator(leaf, idx));
+			}
+
+			/********** Insertion **********/
+
+			// Split an overflowing leaf in 2, returns the new right half
+			leaf_pointer splitLeaf(leaf_pointer leaf)
+			{
+				leaf_pointer right = this->createLeaf();
+
+				this->moveValues(leaf, leaf->count / 2, right);
+
+				right->prev = leaf;
+				right->next = leaf->next;
+				if (leaf->next != NULL)
+					leaf->next->prev = right;
+				else
+					this->_last = right;
+				leaf->next = right;
+				return (right);
+			}
+
+			/* right was split from left, link it in their parent (the last node of path) with separator between them.
+			   If the parent overflows it's split too and it's middle key goes up, up to making a new root */
+			void insertInParent(path_type& path, node_base* left, const key_type& separator, node_base* right)
+			{
+				if (path.depth == 0)
+				{
+					// left was the root
+					inner_pointer root = this->createInner();
+
+					this->_keyAlloc.construct(keys(root), separator);
+					root->children[0] = left;
+					root->children[1] = right;
+					root->count = 1;
+					this->_root = root;
+					++this->_height;
+					return;
+				}
+
+				--path.depth;
+				inner_pointer parent = path.nodes[path.depth];
+				this->insertInInner(parent, path.slots[path.depth], separator, right);
+				if (parent->count <= innerCapacity)
+					return;
+
+				// Keys before mid stay, keys after mid go to sibling, mid itself goes up
+				size_type mid = parent->count / 2;
+				inner_pointer sibling = this->createInner();
+				key_type* k = keys(parent);
+
+				for (size_type i = mid + 1; i < parent->count; ++i)
+				{
+					this->_keyAlloc.construct(keys(sibling) + sibling->count, k[i]);
+					this->_keyAlloc.destroy(k + i);
+					sibling->children[sibling->count] = parent->children[i];
+					++sibling->count;
+				}
+				sibling->children[sibling->count] = parent->children[parent->count];
+
+				key_type up(k[mid]);
+				this->_keyAlloc.destroy(k + mid);
+				parent->count = mid;
+
+				this->insertInParent(path, parent, up, sibling);
+			}
+
+			/********** Deletion **********/
+
+			/* leaf (last of path) is under minLeaf (by any amount, range erase empties whole runs), if it and a sibling
+			   have enough for two leaves, values are moved so that both have half, otherwise they are merged.
+			   Returns where the value at idx in leaf went (idx may be leaf's count, then it's whatever follows leaf) */
+			iterator rebalanceLeaf(path_type& path, leaf_pointer leaf, size_type idx)
+			{
+				inner_pointer parent = path.nodes[path.depth - 1];
+				size_type slot = path.slots[path.depth - 1];
+				leaf_pointer left = (slot > 0) ? static_cast<leaf_pointer>(parent->children[slot - 1]) : NULL;
+				leaf_pointer right = (slot < parent->count) ? static_cast<leaf_pointer>(parent->children[slot + 1]) : NULL;
+
+				if (left != NULL && left->count + leaf->count >= 2 * minLeaf)
+				{
+					// Last values of left go in front of ours
+					size_type move = (left->count - leaf->count) / 2;
+
+					this->shiftValuesRight(leaf, 0, move);
+					for (size_type i = 0; i < move; ++i)
+					{
+						this->_alloc.construct(values(leaf) + i, values(left)[left->count - move + i]);
+						this->_alloc.destroy(values(left) + left->count - move + i);
+					}
+					left->count -= move;
+					leaf->count += move;
+					this->setKey(parent, slot - 1, keyOf(values(leaf)[0]));
+					return (this->normalize(leaf, idx + move));
+				}
+				if (right != NULL && right->count + leaf->count >= 2 * minLeaf)
+				{
+					// First values of right go after ours
+					size_type move = (right->count - leaf->count) / 2;
+
+					for (size_type i = 0; i < move; ++i)
+					{
+						this->_alloc.construct(values(leaf) + leaf->count + i, values(right)[i]);
+						this->_alloc.destroy(values(right) + i);
+					}
+					leaf->count += move;
+					this->shiftValuesLeft(right, 0, move);
+					right->count -= move;
+					this->setKey(parent, slot, keyOf(values(right)[0]));
+					return (this->normalize(leaf, idx));
+				}
+
+				// Less than 2 * minLeaf together, so they fit in one leaf
+				if (left != NULL)
+				{
+					idx += left->count;
+					this->mergeLeaves(left, leaf);
+					this->removeFromInner(parent, slot - 1, slot);
+					leaf = left;
+				}
+				else
+				{
+					this->mergeLeaves(leaf, right);
+					this->removeFromInner(parent, slot, slot + 1);
+				}
+				--path.depth;
+				this->rebalanceInner(path);
+				return (this->normalize(leaf, idx));
+			}
+
+			// Move everything from right to left and drop right
+			void mergeLeaves(leaf_pointer left, leaf_pointer right)
+			{
+				this->moveValues(right, 0, left);
+				left->next = right->next;
+				if (right->next != NULL)
+					right->next->prev = left;
+				else
+					this->_last = left;
+				this->_leafAlloc.deallocate(right, 1);
+			}
+
+			// Same as rebalanceLeaf for inner nodes, separators rotate through the parent
+			void rebalanceInner(path_type& path)
+			{
+				inner_pointer node = path.nodes[path.depth];
+
+				if (path.depth == 0)
+				{
+					// Root with a single child left, the child becomes the root
+					if (node->count == 0)
+					{
+						this->_root = node->children[0];
+						this->_innerAlloc.deallocate(node, 1);
+						--this->_height;
+					}
+					return;
+				}
+				if (node->count >= minInner)
+					return;
+
+				inner_pointer parent = path.nodes[path.depth - 1];
+				size_type slot = path.slots[path.depth - 1];
+				inner_pointer left = (slot > 0) ? static_cast<inner_pointer>(parent->children[slot - 1]) : NULL;
+				inner_pointer right = (slot < parent->count) ? static_cast<inner_pointer>(parent->children[slot + 1]) : NULL;
+
+				if (left != NULL && left->count > minInner)
+				{
+					// Parent separator comes down in front of node, left's last key goes up
+					// (inserting with children[0] as child duplicates it in children[1], then children[0] is replaced)
+					this->insertInInner(node, 0, keys(parent)[slot - 1], node->children[0]);
+					node->children[0] = left->children[left->count];
+					this->setKey(parent, slot - 1, keys(left)[left->count - 1]);
+					this->_keyAlloc.destroy(keys(left) + left->count - 1);
+					--left->count;
+					return;
+				}
+				if (right != NULL && right->count > minInner)
+				{
+					// Mirror, parent separator goes at the end of node, right's first key goes up
+					this->_keyAlloc.construct(keys(node) + node->count, keys(parent)[slot]);
+					node->children[node->count + 1] = right->children[0];
+					++node->count;
+					this->setKey(parent, slot, keys(right)[0]);
+					this->removeFromInner(right, 0, 0);
+					return;
+				}
+
+				if (left != NULL)
+				{
+					this->mergeInner(left, keys(parent)[slot - 1], node);
+					this->removeFromInner(parent, slot - 1, slot);
+				}
+				else
+				{
+					this->mergeInner(node, keys(parent)[slot], right);
+					this->removeFromInner(parent, slot, slot + 1);
+				}
+				--path.depth;
+				this->rebalanceInner(path);
+			}
+
+			// left gets separator then everything from right, right is dropped
+			void mergeInner(inner_pointer left, const key_type& separator, inner_pointer right)
+			{
+				this->_keyAlloc.construct(keys(left) + left->count, separator);
+				left->children[left->count + 1] = right->children[0];
+				++left->count;
+				for (size_type i = 0; i < right->count; ++i)
+				{
+					this->_keyAlloc.construct(keys(left) + left->count, keys(right)[i]);
+					this->_keyAlloc.destroy(keys(right) + i);
+					left->children[left->count + 1] = right->children[i + 1];
+					++left->count;
+				}
+				this->_innerAlloc.deallocate(right, 1);
+			}
+
+			void eraseAt(path_type& path, leaf_pointer leaf, size_type idx)
+			{
+				this->removeFromLeaf(leaf, idx);
+				--this->_size;
+				if (path.depth > 0 && leaf->count < minLeaf)
+					this->rebalanceLeaf(path, leaf, idx);
+			}
+
+			/********** Bulk **********/
+
+			/* Unsorted range into an empty tree: positions of the values are sorted (stable, see MergeSort.hpp), duplicates
+			   dropped keeping the first one of the range, then the tree is built directly. O(n log n), no split at all */
+			template <class ForwardIterator>
+			void buildUnsorted(ForwardIterator first, ForwardIterator last)
+			{
+				typedef PositionCompare<KeyOfValue, key_compare> position_compare;
+
+				size_type n = 0;
+				for (ForwardIterator it = first; it != last; ++it)
+					++n;
+
+				std::allocator<ForwardIterator> arrayAlloc;
+				ForwardIterator* order = arrayAlloc.allocate(2 * n); // Positions then sort buffer
+				for (size_type i = 0; i < n; ++i, ++first)
+				{
+					arrayAlloc.construct(order + i, first);
+					arrayAlloc.construct(order + n + i, first);
+				}
+
+				MergeSort<ForwardIterator, position_compare>::sort(order, order + n, n, position_compare(this->_comp));
+				size_type unique = 1;
+				for (size_type i = 1; i < n; ++i)
+				{
+					if (this->_comp(keyOf(*order[unique - 1]), keyOf(*order[i])))
+						order[unique++] = order[i];
+				}
+				this->buildSorted(PositionValueIterator<ForwardIterator>(order), unique);
+
+				for (size_type i = 0; i < 2 * n; ++i)
+					arrayAlloc.destroy(order + i);
+				arrayAlloc.deallocate(order, 2 * n);
+			}
+
+			// Hinted at the end, so sorted ranges are mostly appended to the last leaf without descending
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				while (first != last)
+					this->insertUnique(this->end(), *first++);
+			}
+
+			// If we are empty the tree is built directly (sorted first if needed), otherwise fallback to one by one
+			template <class ForwardIterator>
+			void insertRange(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n;
+
+				if (!this->empty())
+					this->insertRange(first, last, ft::input_iterator_tag());
+				else if (ft::isSortedUnique(first, last, PositionCompare<KeyOfValue, key_compare>(this->_comp), n))
+					this->buildSorted(first, n);
+				else
+					this->buildUnsorted(first, last);
+			}
+
+			template <class InputIterator>
+			void insertSortedRange(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{ this->insertRange(first, last, ft::input_iterator_tag()); }
+
+			template <class ForwardIterator>
+			void insertSortedRange(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				if (!this->empty())
+					return (this->insertRange(first, last, ft::input_iterator_tag()));
+
+				size_type n = 0;
+				for (ForwardIterator it = first; it != last; ++it)
+					++n;
+				this->buildSorted(first, n);
+			}
+
+		public:
+			BPlusTree(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _leafAlloc(), _innerAlloc(), _keyAlloc(), _comp(comp)
+			{
+				this->resetRoot();
+			}
+
+			// Values come out sorted and unique, so rebuild in O(n)
+			BPlusTree(const self_type& tree)
+			: _alloc(tree._alloc), _leafAlloc(), _innerAlloc(), _keyAlloc(), _comp(tree._comp)
+			{
+				this->resetRoot();
+				this->buildSorted(tree.begin(), tree.size());
+			}
+
+			~BPlusTree()
+			{
+				this->deleteSubtree(this->_root);
+			}
+
+			self_type& operator=(const self_type& tree)
+			{
+				if (this == &tree)
+					return (*this);
+
+				this->clear();
+				this->_alloc = tree._alloc;
+				this->_comp = tree._comp;
+				this->buildSorted(tree.begin(), tree.size());
+				return (*this);
+			}
+
+			iterator begin() const { return (iterator(this->_first, 0)); }
+			iterator end() const { return (iterator(this->_last, this->_last->count)); }
+
+			reverse_iterator rbegin() const { return (reverse_iterator(this->end())); }
+			reverse_iterator rend() const { return (reverse_iterator(this->begin())); }
+
+			size_type size() const { return (this->_size); }
+			bool empty() const { return (this->_size == 0); }
+			size_type height() const { return (this->_height + 1); }
+
+			size_type max_size() const { return (this->_alloc.max_size()); }
+
+			key_compare key_comp() const { return (this->_comp); }
+
+			/********** Lookup **********/
+
+			iterator search(const key_type& key) const
+			{
+				leaf_pointer leaf = this->descend(key, NULL);
+				size_type idx = this->leafLowerBound(leaf, key);
+
+				if (idx == leaf->count || this->_comp(key, keyOf(values(leaf)[idx])))
+					return (this->end());
+				return (iterator(leaf, idx));
+			}
+
+			// Separators send keys equal to them right, so the bound is either in this leaf or the first of the next
+			iterator lowerBound(const key_type& key) const
+			{
+				leaf_pointer leaf = this->descend(key, NULL);
+				return (this->normalize(leaf, this->leafLowerBound(leaf, key)));
+			}
+
+			iterator upperBound(const key_type& key) const
+			{
+				leaf_pointer leaf = this->descend(key, NULL);
+				return (this->normalize(leaf, this->leafUpperBound(leaf, key)));
+			}
+
+			ft::pair<iterator, iterator> equalRange(const key_type& key) const
+			{
+				leaf_pointer leaf = this->descend(key, NULL);
+				size_type idx = this->leafLowerBound(leaf, key);
+
+				if (idx == leaf->count || this->_comp(key, keyOf(values(leaf)[idx])))
+					return (ft::make_pair(this->normalize(leaf, idx), this->normalize(leaf, idx)));
+				return (ft::make_pair(iterator(leaf, idx), this->normalize(leaf, idx + 1)));
+			}
+
+			/********** Modifiers **********/
+
+			/* Single descent looking for key, returns where it is if it's there, otherwise end() and pos is where it goes,
+			   so that the caller can then call insertAt without searching again (eg. build the value only if needed) */
+			iterator searchInsertPosition(const key_type& key, insert_position& pos) const
+			{
+				pos.leaf = this->descend(key, &pos.path);
+				pos.idx = this->leafLowerBound(pos.leaf, key);
+
+				if (pos.idx < pos.leaf->count && !this->_comp(key, keyOf(values(pos.leaf)[pos.idx])))
+					return (iterator(pos.leaf, pos.idx));
+				return (this->end());
+			}
+
+			// Insert val where searchInsertPosition said, splitting the leaf (and up) if it overflows. Returns where val is
+			iterator insertAt(insert_position& pos, const value_type& val)
+			{
+				leaf_pointer leaf = pos.leaf;
+				size_type idx = pos.idx;
+
+				this->insertInLeaf(leaf, idx, val);
+				++this->_size;
+				if (leaf->count <= leafCapacity)
+					return (iterator(leaf, idx));
+
+				leaf_pointer right = this->splitLeaf(leaf);
+				this->insertInParent(pos.path, leaf, keyOf(values(right)[0]), right);
+				if (idx < leaf->count)
+					return (iterator(leaf, idx));
+				return (iterator(right, idx - leaf->count));
+			}
+
+			// Returns where the value with val's key is, and true if val was inserted, false if some was already there
+			ft::pair<iterator, bool> insertUnique(const value_type& val)
+			{
+				insert_position pos;
+				iterator found = this->searchInsertPosition(keyOf(val), pos);
+
+				if (found != this->end())
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(this->insertAt(pos, val), true));
+			}
+
+			/* Same but hint is where we think val goes (right before it). If it's right and the hint's leaf has room,
+			   val goes there without any descent (amortized O(1) when inserting sorted values at end()).
+			   Only when the neighbours are in the same leaf though, or at the very begining / end: separators above
+			   a leaf are not known without descending, so a key right before a leaf's first value may belong to the
+			   previous leaf. Otherwise it's the usual descent */
+			ft::pair<iterator, bool> insertUnique(const_iterator hint, const value_type& val)
+			{
+				leaf_pointer leaf = hint.getLeaf();
+				size_type idx = hint.getIndex();
+				const key_type& key = keyOf(val);
+
+				if (leaf->count < leafCapacity
+					&& ((idx < leaf->count) ? (idx > 0 || leaf == this->_first) && this->_comp(key, keyOf(values(leaf)[idx]))
+											: leaf == this->_last)
+					&& (idx == 0 || this->_comp(keyOf(values(leaf)[idx - 1]), key)))
+				{
+					this->insertInLeaf(leaf, idx, val);
+					++this->_size;
+					return (ft::make_pair(iterator(leaf, idx), true));
+				}
+				return (this->insertUnique(val));
+			}
+
+			// Any range, sorted ranges are built in O(n) when we are empty
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last)
+			{ this->insertRange(first, last, ft::iterator_category_of(first)); }
+
+			// Same but the caller promises the range is sorted without duplicates (see ft::sorted_unique)
+			template <class InputIterator>
+			void insertSortedRange(InputIterator first, InputIterator last)
+			{ this->insertSortedRange(first, last, ft::iterator_category_of(first)); }
+
+			// Returns the number of values removed (0 or 1 since keys are unique)
+			size_type remove(const key_type& key)
+			{
+				path_type path;
+				leaf_pointer leaf = this->descend(key, &path);
+				size_type idx = this->leafLowerBound(leaf, key);
+
+				if (idx == leaf->count || this->_comp(key, keyOf(values(leaf)[idx])))
+					return (0);
+				this->eraseAt(path, leaf, idx);
+				return (1);
+			}
+
+			/* Removed right in it's leaf, no search. Only a leaf going under minLeaf needs it's parents: they are found
+			   from it's first key then (a descent once in a while, not per erase). Returns the value that followed */
+			iterator remove(const_iterator position)
+			{
+				leaf_pointer leaf = position.getLeaf();
+				size_type idx = position.getIndex();
+
+				this->removeFromLeaf(leaf, idx);
+				--this->_size;
+				if (leaf == this->_root || leaf->count >= minLeaf)
+					return (this->normalize(leaf, idx));
+
+				path_type path;
+				this->descend(keyOf(values(leaf)[0]), &path);
+				return (this->rebalanceLeaf(path, leaf, idx));
+			}
+
+			/* Rebalancing moves values around, so iterators can't be kept. Instead the range is erased leaf by leaf:
+			   a single descent to the leaf holding the first key left to erase, everything of the range in that leaf
+			   goes at once, and the leaf is rebalanced once. Only the first key of the next leaf is kept to go on from there.
+			   O(k + (k / leaf size) * log n) for k values. Returns the value that followed the range */
+			iterator removeRange(const_iterator first, const_iterator last)
+			{
+				size_type n = 0;
+
+				for (const_iterator it = first; it != last; ++it)
+					++n;
+				if (n == this->_size)
+				{
+					this->clear();
+					return (this->end());
+				}
+				if (n == 0)
+					return (iterator(first.getLeaf(), first.getIndex()));
+
+				// Not assigned, only constructed / destroyed like the separators
+				key_type* key = this->_keyAlloc.allocate(1);
+				this->_keyAlloc.construct(key, keyOf(*first));
+				while (true)
+				{
+					path_type path;
+					leaf_pointer leaf = this->descend(*key, &path);
+					size_type idx = this->leafLowerBound(leaf, *key);
+					size_type run = (n < leaf->count - idx) ? n : leaf->count - idx;
+
+					for (size_type i = idx; i < idx + run; ++i)
+						this->_alloc.destroy(values(leaf) + i);
+					this->shiftValuesLeft(leaf, idx, run);
+					leaf->count -= run;
+					this->_size -= run;
+					n -= run;
+
+					// The run went to the end of the leaf, so the rest starts with the next leaf
+					if (n > 0)
+					{
+						this->_keyAlloc.destroy(key);
+						this->_keyAlloc.construct(key, keyOf(values(leaf->next)[0]));
+					}
+					if (path.depth > 0 && leaf->count < minLeaf)
+						this->rebalanceLeaf(path, leaf, idx);
+					if (n == 0)
+						break;
+				}
+
+				// Everything from key to last is gone, so last is now key's lower bound
+				iterator next = this->lowerBound(*key);
+				this->_keyAlloc.destroy(key);
+				this->_keyAlloc.deallocate(key, 1);
+				return (next);
+			}
+
+			void clear()
+			{
+				this->deleteSubtree(this->_root);
+				this->resetRoot();
+			}
+
+			/* Build the tree from the n next values of first, which must be sorted without duplicates, no comparison is made.
+			   Tree must be empty. Leaves are filled evenly, then each level of inner nodes is built on top of the previous one,
+			   separators being the smallest key of each child */
+			template <class ForwardIterator>
+			void buildSorted(ForwardIterator first, size_type n)
+			{
+				if (n == 0)
+					return;
+				this->_leafAlloc.deallocate(static_cast<leaf_pointer>(this->_root), 1);
+
+				size_type count = (n + leafCapacity - 1) / leafCapacity;
+				std::allocator<node_base*> nodeAlloc;
+				std::allocator<const key_type*> minAlloc;
+				node_base** nodes = nodeAlloc.allocate(count);
+				const key_type** mins = minAlloc.allocate(count); // Smallest key under each node of the level
+
+				leaf_pointer prev = NULL;
+				for (size_type i = 0; i < count; ++i)
+				{
+					leaf_pointer leaf = this->createLeaf();
+					size_type fill = n / count + ((i < n % count) ? 1 : 0);
+
+					for (; leaf->count < fill; ++first)
+						this->_alloc.construct(values(leaf) + leaf->count++, *first);
+					leaf->prev = prev;
+					if (prev != NULL)
+						prev->next = leaf;
+					else
+						this->_first = leaf;
+					prev = leaf;
+					nodes[i] = leaf;
+					mins[i] = &keyOf(values(leaf)[0]);
+				}
+				this->_last = prev;
+
+				// Each level groups the previous one evenly, writing it's nodes in place since it has less of them
+				this->_height = 0;
+				while (count > 1)
+				{
+					size_type parents = (count + innerCapacity) / (innerCapacity + 1);
+					size_type child = 0;
+
+					for (size_type i = 0; i < parents; ++i)
+					{
+						inner_pointer node = this->createInner();
+						size_type fill = count / parents + ((i < count % parents) ? 1 : 0);
+						const key_type* min = mins[child];
+
+						node->children[0] = nodes[child++];
+						for (size_type j = 1; j < fill; ++j, ++child)
+						{
+							this->_keyAlloc.construct(keys(node) + node->count, *mins[child]);
+							node->children[++node->count] = nodes[child];
+						}
+						nodes[i] = node;
+						mins[i] = min;
+					}
+					count = parents;
+					++this->_height;
+				}
+
+				this->_root = nodes[0];
+				this->_size = n;
+				nodeAlloc.deallocate(nodes, (n + leafCapacity - 1) / leafCapacity);
+				minAlloc.deallocate(mins, (n + leafCapacity - 1) / leafCapacity);
+			}
+
+			void swap(self_type& x)
+			{
+				allocator_type tmp_alloc = this->_alloc;
+				key_compare tmp_comp = this->_comp;
+				node_base* tmp_root = this->_root;
+				leaf_pointer tmp_first = this->_first;
+				leaf_pointer tmp_last = this->_last;
+				size_type tmp_size = this->_size;
+				size_type tmp_height = this->_height;
+
+				this->_alloc = x._alloc;
+				this->_comp = x._comp;
+				this->_root = x._root;
+				this->_first = x._first;
+				this->_last = x._last;
+				this->_size = x._size;
+				this->_height = x._height;
+
+				x._alloc = tmp_alloc;
+				x._comp = tmp_comp;
+				x._root = tmp_root;
+				x._first = tmp_first;
+				x._last = tmp_last;
+				x._size = tmp_size;
+				x._height = tmp_height;
+			}
+	};
+
+}
+
+#endif
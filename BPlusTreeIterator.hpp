@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 15:40 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BPLUSTREEITERATOR_HPP
+# define BPLUSTREEITERATOR_HPP
+
+#include "utils.hpp"
+#include "iterators.hpp"
+
+namespace ft
+{
+
+	/* Tree is the BPlusTree type, an iterator is a leaf and an index in it.
+	   Leaves are linked, so ++ / -- are just index moves, and only follow a link when leaving a leaf.
+	   end() is one past the last value of the last leaf */
+	template <class Tree, bool IsConst = false>
+	class BPlusTreeIterator : public ft::iterator<
+												  ft::bidirectional_iterator_tag,
+												  typename ft::choose<IsConst, const typename Tree::value_type, typename Tree::value_type>::type
+												 >
+	{
+		protected:
+			typedef typename ft::iterator<ft::bidirectional_iterator_tag, typename ft::choose<IsConst, const typename Tree::value_type, typename Tree::value_type>::type> it;
+
+			typename Tree::leaf_pointer	_leaf;
+			typename Tree::size_type	_idx;
+
+		public:
+			BPlusTreeIterator(typename Tree::leaf_pointer leaf = NULL, typename Tree::size_type idx = 0) : _leaf(leaf), _idx(idx) { }
+			BPlusTreeIterator(const BPlusTreeIterator<Tree, IsConst>& it) : _leaf(it._leaf), _idx(it._idx) { }
+			~BPlusTreeIterator() { }
+
+			BPlusTreeIterator<Tree, IsConst>& operator=(const BPlusTreeIterator<Tree, IsConst>& it)
+			{
+				this->_leaf = it._leaf;
+				this->_idx = it._idx;
+				return (*this);
+			}
+
+			// Allow conversion from non-const to const, but not the other way around
+			operator BPlusTreeIterator<Tree, true>() { return (BPlusTreeIterator<Tree, true>(this->_leaf, this->_idx)); }
+
+			// Where the value is, so that containers can give it back to the tree
+			typename Tree::leaf_pointer getLeaf() const { return (this->_leaf); }
+			typename Tree::size_type getIndex() const { return (this->_idx); }
+
+			/********** Relational operators **********/
+
+			// *A
+			typename it::reference operator*() const { return (Tree::valueAt(this->_leaf, this->_idx)); }
+
+			// A->m, eg. 'it->first' and 'it->second' for map
+			typename it::pointer operator->() const { return (&(Tree::valueAt(this->_leaf, this->_idx))); }
+
+			// ++A, stays on end()
+			BPlusTreeIterator<Tree, IsConst>& operator++()
+			{
+				if (this->_idx < this->_leaf->count)
+					++this->_idx;
+				if (this->_idx == this->_leaf->count && this->_leaf->next != NULL)
+				{
+					this->_leaf = this->_leaf->next;
+					this->_idx = 0;
+				}
+				return (*this);
+			}
+
+			// --A, stays on begin()
+			BPlusTreeIterator<Tree, IsConst>& operator--()
+			{
+				if (this->_idx > 0)
+					--this->_idx;
+				else if (this->_leaf->prev != NULL)
+				{
+					this->_leaf = this->_leaf->prev;
+					this->_idx = this->_leaf->count - 1;
+				}
+				return (*this);
+			}
+
+			// A++
+			BPlusTreeIterator<Tree, IsConst> operator++(int) { BPlusTreeIterator<Tree, IsConst> tmp = *this; ++(*this); return (tmp); }
+
+			// A--
+			BPlusTreeIterator<Tree, IsConst> operator--(int) { BPlusTreeIterator<Tree, IsConst> tmp = *this; --(*this); return (tmp); }
+
+			/********** Friend relational operators, to allow const and non-const mixed **********/
+
+			template <class LTree, bool LIsConst, class RTree, bool RIsConst>
+			friend bool operator==(const BPlusTreeIterator<LTree, LIsConst>& lhs, const BPlusTreeIterator<RTree, RIsConst>& rhs);
+
+			template <class LTree, bool LIsConst, class RTree, bool RIsConst>
+			friend bool operator!=(const BPlusTreeIterator<LTree, LIsConst>& lhs, const BPlusTreeIterator<RTree, RIsConst>& rhs);
+
+	};
+
+	template <class LTree, bool LIsConst, class RTree, bool RIsConst>
+	bool operator==(const BPlusTreeIterator<LTree, LIsConst>& lhs, const BPlusTreeIterator<RTree, RIsConst>& rhs)
+	{ return (lhs._leaf == rhs._leaf && lhs._idx == rhs._idx); }
+
+	template <class LTree, bool LIsConst, class RTree, bool RIsConst>
+	bool operator!=(const BPlusTreeIterator<LTree, LIsConst>& lhs, const BPlusTreeIterator<RTree, RIsConst>& rhs)
+	{ return (!(lhs == rhs)); }
+
+}
+
+#endif
@@ -0,0 +1,551 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHTABLE_HPP
+# define HASHTABLE_HPP
+
+#include "pairs.hpp"
+#include "HashTableIterator.hpp"
+
+#include <memory>
+#include <cstring>
+#include <cstddef>
+#include <stdint.h>
+
+// SSE2 is always there on x86-64, other targets use the plain loop version of Group
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+	/* Open addressing hash table with UNIQUE keys, same Key / KeyOfValue idea as RedBlackTree.
+	   Values live directly in one array of slots, and each slot has a control byte in a second array:
+	   - full slots store 7 bits of the key's hash (so 0 to 127)
+	   - free slots are ctrlEmpty (never used) or ctrlDeleted (erased, a tombstone)
+	   Slots are looked at by groups of 16, one SSE2 compare checks the 16 control bytes of a group at once,
+	   so most lookups only compare a single key, the one whose 7 bits matched. */
+	template <class Key, class T, class KeyOfValue, class Hash, class KeyEqual, class Allocator = std::allocator<T> >
+	class HashTable
+	{
+		private:
+			typedef HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Allocator> self_type;
+
+		public:
+			typedef Key						key_type;
+			typedef T						value_type;
+			typedef Hash					hasher;
+			typedef KeyEqual				key_equal;
+			typedef Allocator				allocator_type;
+
+			typedef signed char				ctrl_type;
+			typedef ctrl_type*				ctrl_pointer;
+			typedef value_type*				slot_pointer;
+
+			typedef HashTableIterator<self_type, false>	iterator;
+			typedef HashTableIterator<self_type, true>	const_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+			// Free control bytes are negative, so full ones can be told apart with a sign check
+			static const ctrl_type ctrlEmpty = -128;
+			static const ctrl_type ctrlDeleted = -2;
+			static const ctrl_type ctrlEnd = -1; // Right after the last slot, stops iterators
+
+			static const size_type groupSize = 16;
+
+			static bool isFree(ctrl_type ctrl) { return (ctrl < ctrlEnd); }
+
+		private:
+			typedef typename allocator_type::template rebind<ctrl_type>::other ctrl_allocator_type;
+
+			/* The 16 control bytes of a group, each match gives a bit mask with bit i set if slot i of the group matches.
+			   Groups are aligned (slots 0-15, 16-31...), so a group never goes past the last slot */
+			class Group
+			{
+				private:
+#if defined(__SSE2__)
+					__m128i _ctrl;
+
+				public:
+					explicit Group(const ctrl_type* ctrl) : _ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) { }
+
+					unsigned int match(ctrl_type h2) const
+					{ return (static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->_ctrl)))); }
+
+					unsigned int matchEmpty() const { return (this->match(ctrlEmpty)); }
+
+					// Empty or deleted, both are smaller than ctrlEnd (signed compare)
+					unsigned int matchFree() const
+					{ return (static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(ctrlEnd), this->_ctrl)))); }
+#else
+					const ctrl_type* _ctrl;
+
+				public:
+					explicit Group(const ctrl_type* ctrl) : _ctrl(ctrl) { }
+
+					unsigned int match(ctrl_type h2) const
+					{
+						unsigned int bits = 0;
+						for (size_type i = 0; i < groupSize; ++i)
+						{
+							if (this->_ctrl[i] == h2)
+								bits |= 1u << i;
+						}
+						return (bits);
+					}
+
+					unsigned int matchEmpty() const { return (this->match(ctrlEmpty)); }
+
+					unsigned int matchFree() const
+					{
+						unsigned int bits = 0;
+						for (size_type i = 0; i < groupSize; ++i)
+						{
+							if (isFree(this->_ctrl[i]))
+								bits |= 1u << i;
+						}
+						return (bits);
+					}
+#endif
+			};
+
+			ctrl_pointer	_ctrl;			// _capacity control bytes + ctrlEnd
+			slot_pointer	_slots;
+			size_type		_capacity;		// Power of 2, 0 or at least groupSize
+			size_type		_size;
+			size_type		_growthLeft;	// Inserts left before a rehash, tombstones count as used
+
+			hasher					_hash;
+			key_equal				_equal;
+			allocator_type			_alloc;
+			ctrl_allocator_type		_ctrlAlloc;
+
+			static const key_type& keyOf(const value_type& val) { return (KeyOfValue()(val)); }
+
+			// Tables without slots point here, so begin() == end() without allocating anything
+			static ctrl_pointer emptyCtrl()
+			{
+				static ctrl_type end = ctrlEnd;
+				return (&end);
+			}
+
+			// Index of the lowest bit set, bits can't be 0
+			static size_type lowestBit(unsigned int bits)
+			{
+#if defined(__GNUC__)
+				return (static_cast<size_type>(__builtin_ctz(bits)));
+#else
+				size_type i = 0;
+				while (!(bits & 1u))
+				{
+					bits >>= 1;
+					++i;
+				}
+				return (i);
+#endif
+			}
+
+			// Mix the user's hash (ft::hash<int> gives the int itself), otherwise keys like 0, 16, 32... all go in the same group
+			size_type hashOf(const key_type& key) const
+			{
+				uint64_t h = static_cast<uint64_t>(this->_hash(key));
+
+				h ^= h >> 33;
+				h *= 0xff51afd7ed558ccdULL;
+				h ^= h >> 33;
+				return (static_cast<size_type>(h));
+			}
+
+			// Low 7 bits go in the control byte, the rest chooses the first group to look at
+			static ctrl_type h2Of(size_type h) { return (static_cast<ctrl_type>(h & 0x7F)); }
+			static size_type h1Of(size_type h) { return (h >> 7); }
+
+			// 7/8 of the slots at most are used, so there always are empty slots to stop lookups
+			static size_type maxLoad(size_type capacity) { return (capacity - capacity / 8); }
+
+			// Smallest capacity holding n values
+			static size_type capacityFor(size_type n)
+			{
+				if (n == 0)
+					return (0);
+
+				size_type capacity = groupSize;
+				while (maxLoad(capacity) < n)
+					capacity *= 2;
+				return (capacity);
+			}
+
+			/* Groups are visited at first, first + 1, first + 3, first + 6... (modulo the group count),
+			   with a power of 2 group count that goes through every group once before coming back */
+
+			// Index of the slot holding key, _capacity if none
+			size_type findIndex(const key_type& key, size_type h) const
+			{
+				if (this->_capacity == 0)
+					return (0);
+
+				const ctrl_type h2 = h2Of(h);
+				const size_type mask = this->_capacity / groupSize - 1;
+				size_type group = h1Of(h) & mask;
+
+				for (size_type step = 1; ; ++step)
+				{
+					const size_type first = group * groupSize;
+					const Group g(this->_ctrl + first);
+
+					for (unsigned int bits = g.match(h2); bits != 0; bits &= bits - 1)
+					{
+						const size_type idx = first + lowestBit(bits);
+						if (this->_equal(keyOf(this->_slots[idx]), key))
+							return (idx);
+					}
+					// Key would have been put in this empty slot (or before), so it's not in the table
+					if (g.matchEmpty() != 0)
+						return (this->_capacity);
+					group = (group + step) & mask;
+				}
+			}
+
+			// First free slot (empty or deleted) on the way of a hash, there always is one
+			size_type findFree(size_type h) const
+			{
+				const size_type mask = this->_capacity / groupSize - 1;
+				size_type group = h1Of(h) & mask;
+
+				for (size_type step = 1; ; ++step)
+				{
+					const unsigned int bits = Group(this->_ctrl + group * groupSize).matchFree();
+
+					if (bits != 0)
+						return (group * groupSize + lowestBit(bits));
+					group = (group + step) & mask;
+				}
+			}
+
+			/* Lookup and free slot search in one probe: the slot of key (and true), otherwise the first free slot seen on
+			   the way, where key would go (and false). _capacity if there are no slots */
+			ft::pair<size_type, bool> findSlot(const key_type& key, size_type h) const
+			{
+				if (this->_capacity == 0)
+					return (ft::make_pair(this->_capacity, false));
+
+				const ctrl_type h2 = h2Of(h);
+				const size_type mask = this->_capacity / groupSize - 1;
+				size_type group = h1Of(h) & mask;
+				size_type freeSlot = this->_capacity;
+
+				for (size_type step = 1; ; ++step)
+				{
+					const size_type first = group * groupSize;
+					const Group g(this->_ctrl + first);
+
+					for (unsigned int bits = g.match(h2); bits != 0; bits &= bits - 1)
+					{
+						const size_type idx = first + lowestBit(bits);
+						if (this->_equal(keyOf(this->_slots[idx]), key))
+							return (ft::make_pair(idx, true));
+					}
+					if (freeSlot == this->_capacity)
+					{
+						const unsigned int bits = g.matchFree();
+						if (bits != 0)
+							freeSlot = first + lowestBit(bits);
+					}
+					if (g.matchEmpty() != 0)
+						return (ft::make_pair(freeSlot, false));
+					group = (group + step) & mask;
+				}
+			}
+
+			void allocateSlots(size_type capacity)
+			{
+				this->_capacity = capacity;
+				this->_growthLeft = maxLoad(capacity);
+				if (capacity == 0)
+				{
+					this->_ctrl = emptyCtrl();
+					this->_slots = NULL;
+					return;
+				}
+				this->_slots = this->_alloc.allocate(capacity);
+				this->_ctrl = this->_ctrlAlloc.allocate(capacity + 1);
+				std::memset(this->_ctrl, ctrlEmpty, capacity);
+				this->_ctrl[capacity] = ctrlEnd;
+			}
+
+			// Only frees memory, values must be destroyed before
+			void deallocateSlots()
+			{
+				if (this->_capacity == 0)
+					return;
+				this->_alloc.deallocate(this->_slots, this->_capacity);
+				this->_ctrlAlloc.deallocate(this->_ctrl, this->_capacity + 1);
+			}
+
+			void destroyValues()
+			{
+				for (size_type i = 0; i < this->_capacity; ++i)
+				{
+					if (!isFree(this->_ctrl[i]))
+						this->_alloc.destroy(this->_slots + i);
+				}
+			}
+
+			// Puts val (of hash h) in the free slot idx
+			size_type fillSlot(size_type idx, size_type h, const value_type& val)
+			{
+				this->_alloc.construct(this->_slots + idx, val);
+				// Tombstones were already taken out of _growthLeft
+				if (this->_ctrl[idx] == ctrlEmpty)
+					--this->_growthLeft;
+				this->_ctrl[idx] = h2Of(h);
+				++this->_size;
+				return (idx);
+			}
+
+			// Puts a value we know is not there yet, in a table we know has room for it
+			size_type insertNew(const value_type& val, size_type h)
+			{ return (this->fillSlot(this->findFree(h), h, val)); }
+
+			// Move every value to a table of the given capacity, tombstones don't follow
+			void rehashTo(size_type capacity)
+			{
+				ctrl_pointer oldCtrl = this->_ctrl;
+				slot_pointer oldSlots = this->_slots;
+				size_type oldCapacity = this->_capacity;
+
+				this->allocateSlots(capacity);
+				this->_size = 0;
+				for (size_type i = 0; i < oldCapacity; ++i)
+				{
+					if (isFree(oldCtrl[i]))
+						continue;
+					this->insertNew(oldSlots[i], this->hashOf(keyOf(oldSlots[i])));
+					this->_alloc.destroy(oldSlots + i);
+				}
+				if (oldCapacity != 0)
+				{
+					this->_alloc.deallocate(oldSlots, oldCapacity);
+					this->_ctrlAlloc.deallocate(oldCtrl, oldCapacity + 1);
+				}
+			}
+
+			// No room left: if tombstones take a lot of it, clean them at the same capacity, otherwise grow
+			void makeRoom()
+			{
+				if (this->_capacity != 0 && this->_size + 1 <= maxLoad(this->_capacity) / 2)
+					this->rehashTo(this->_capacity);
+				else
+					this->rehashTo(capacityFor(this->_size + 1) > this->_capacity * 2 ? capacityFor(this->_size + 1) : this->_capacity * 2);
+			}
+
+		public:
+			HashTable(size_type buckets = 0, const hasher& hash = hasher(), const key_equal& equal = key_equal(),
+					  const allocator_type& alloc = allocator_type())
+			: _size(0), _hash(hash), _equal(equal), _alloc(alloc), _ctrlAlloc(alloc)
+			{ this->allocateSlots(capacityFor(buckets)); }
+
+			// Same capacity and same slots, so control bytes are copied as they are
+			HashTable(const self_type& x)
+			: _size(0), _hash(x._hash), _equal(x._equal), _alloc(x._alloc), _ctrlAlloc(x._ctrlAlloc)
+			{
+				this->allocateSlots(x._capacity);
+				for (size_type i = 0; i < x._capacity; ++i)
+				{
+					if (!isFree(x._ctrl[i]))
+						this->_alloc.construct(this->_slots + i, x._slots[i]);
+				}
+				if (x._capacity != 0)
+					std::memcpy(this->_ctrl, x._ctrl, x._capacity);
+				this->_size = x._size;
+				this->_growthLeft = x._growthLeft;
+			}
+
+			~HashTable()
+			{
+				this->destroyValues();
+				this->deallocateSlots();
+			}
+
+			self_type& operator=(const self_type& x)
+			{
+				if (this == &x)
+					return (*this);
+
+				self_type tmp(x);
+				this->swap(tmp);
+				return (*this);
+			}
+
+			iterator		begin() { return (iterator(this->_ctrl, this->_slots).skipFree()); }
+			const_iterator	begin() const { return (const_iterator(this->_ctrl, this->_slots).skipFree()); }
+
+			iterator		end() { return (iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity)); }
+			const_iterator	end() const { return (const_iterator(this->_ctrl + this->_capacity, this->_slots + this->_capacity)); }
+
+			// Iterator on slot idx, end() for _capacity
+			iterator		at(size_type idx) { return (iterator(this->_ctrl + idx, this->_slots + idx)); }
+			const_iterator	at(size_type idx) const { return (const_iterator(this->_ctrl + idx, this->_slots + idx)); }
+
+			size_type size() const { return (this->_size); }
+			bool empty() const { return (this->_size == 0); }
+			size_type max_size() const { return (this->_alloc.max_size()); }
+
+			hasher hash_function() const { return (this->_hash); }
+			key_equal key_eq() const { return (this->_equal); }
+
+			/********** Buckets, here a bucket is a slot **********/
+			size_type bucketCount() const { return (this->_capacity); }
+
+			static float maxLoadFactor() { return (0.875f); }
+
+			// Capacity for at least buckets slots and the values we have, can shrink, rehash(0) fits the table to its size
+			void rehash(size_type buckets)
+			{
+				size_type capacity = capacityFor(this->_size);
+
+				if (buckets > capacity)
+				{
+					capacity = groupSize;
+					while (capacity < buckets)
+						capacity *= 2;
+				}
+				if (capacity != this->_capacity)
+					this->rehashTo(capacity);
+			}
+
+			// Room for n values without rehashing, never shrinks
+			void reserve(size_type n)
+			{
+				if (n > this->_size && n - this->_size > this->_growthLeft)
+					this->rehashTo(capacityFor(n) > this->_capacity ? capacityFor(n) : this->_capacity);
+			}
+
+			/********** Lookup **********/
+
+			// Index of the slot holding key, bucketCount() if not there
+			size_type search(const key_type& key) const { return (this->findIndex(key, this->hashOf(key))); }
+
+			/********** Modifiers **********/
+
+			/* Hashes and probes once for a lookup followed by an insert (see findSlot): the index of key's value and true,
+			   or the slot key would go in and false. h is set to key's hash, then insertAt(slot, h, value) if it wasn't there */
+			ft::pair<size_type, bool> findOrInsertSlot(const key_type& key, size_type& h) const
+			{
+				h = this->hashOf(key);
+				return (this->findSlot(key, h));
+			}
+
+			/* Puts val (of hash h, whose key is not there) in slot, as given by findOrInsertSlot with nothing inserted since.
+			   A tombstone is reused as is, an empty slot needs room: without it the table grows and val goes where it can */
+			size_type insertAt(size_type slot, size_type h, const value_type& val)
+			{
+				if (this->_capacity == 0 || (this->_ctrl[slot] == ctrlEmpty && this->_growthLeft == 0))
+				{
+					this->makeRoom();
+					return (this->insertNew(val, h));
+				}
+				return (this->fillSlot(slot, h, val));
+			}
+
+			// Index of the value with val's key, and true if val was inserted, false if some was already there
+			ft::pair<size_type, bool> insertUnique(const value_type& val)
+			{
+				size_type h;
+				const ft::pair<size_type, bool> slot = this->findOrInsertSlot(keyOf(val), h);
+
+				if (slot.second)
+					return (ft::make_pair(slot.first, false));
+				return (ft::make_pair(this->insertAt(slot.first, h, val), true));
+			}
+
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last)
+			{
+				for (; first != last; ++first)
+					this->insertUnique(*first);
+			}
+
+			// Slot idx must be full. Nothing moves, so other iterators stay valid
+			void removeAt(size_type idx)
+			{
+				this->_alloc.destroy(this->_slots + idx);
+				--this->_size;
+
+				/* A group with an empty slot stops lookups, so no value was put further away because of it,
+				   this slot can be empty again instead of a tombstone */
+				if (Group(this->_ctrl + (idx & ~(groupSize - 1))).matchEmpty() != 0)
+				{
+					this->_ctrl[idx] = ctrlEmpty;
+					++this->_growthLeft;
+				}
+				else
+					this->_ctrl[idx] = ctrlDeleted;
+			}
+
+			// Returns the number of values removed (0 or 1 since keys are unique)
+			size_type remove(const key_type& key)
+			{
+				const size_type idx = this->search(key);
+
+				if (idx == this->_capacity)
+					return (0);
+				this->removeAt(idx);
+				return (1);
+			}
+
+			// Keeps the slots, like a vector keeps its capacity
+			void clear()
+			{
+				this->destroyValues();
+				if (this->_capacity != 0)
+					std::memset(this->_ctrl, ctrlEmpty, this->_capacity);
+				this->_size = 0;
+				this->_growthLeft = maxLoad(this->_capacity);
+			}
+
+			void swap(self_type& x)
+			{
+				ctrl_pointer tmp_ctrl = this->_ctrl;
+				slot_pointer tmp_slots = this->_slots;
+				size_type tmp_capacity = this->_capacity;
+				size_type tmp_size = this->_size;
+				size_type tmp_growth = this->_growthLeft;
+				hasher tmp_hash = this->_hash;
+				key_equal tmp_equal = this->_equal;
+
+				this->_ctrl = x._ctrl;
+				this->_slots = x._slots;
+				this->_capacity = x._capacity;
+				this->_size = x._size;
+				this->_growthLeft = x._growthLeft;
+				this->_hash = x._hash;
+				this->_equal = x._equal;
+
+				x._ctrl = tmp_ctrl;
+				x._slots = tmp_slots;
+				x._capacity = tmp_capacity;
+				x._size = tmp_size;
+				x._growthLeft = tmp_growth;
+				x._hash = tmp_hash;
+				x._equal = tmp_equal;
+			}
+
+			// Slot index of an iterator, so containers can erase through it
+			size_type indexOf(const_iterator it) const { return (static_cast<size_type>(it.getCtrl() - this->_ctrl)); }
+	};
+
+}
+
+#endif
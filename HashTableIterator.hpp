@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASHTABLEITERATOR_HPP
+# define HASHTABLEITERATOR_HPP
+
+#include "utils.hpp"
+#include "iterators.hpp"
+
+namespace ft
+{
+
+	/* Table is the HashTable type, an iterator is a control byte and the slot going with it.
+	   Walks the slots in memory order skipping the free ones, so the order means nothing (like std::unordered_map).
+	   The control byte right after the last slot is Table::ctrlEnd, that's end() and what stops ++ */
+	template <class Table, bool IsConst = false>
+	class HashTableIterator : public ft::iterator<
+												  ft::forward_iterator_tag,
+												  typename ft::choose<IsConst, const typename Table::value_type, typename Table::value_type>::type
+												 >
+	{
+		protected:
+			typedef typename ft::iterator<ft::forward_iterator_tag, typename ft::choose<IsConst, const typename Table::value_type, typename Table::value_type>::type> it;
+
+			typename Table::ctrl_pointer	_ctrl;
+			typename Table::slot_pointer	_slot;
+
+		public:
+			HashTableIterator(typename Table::ctrl_pointer ctrl = NULL, typename Table::slot_pointer slot = NULL) : _ctrl(ctrl), _slot(slot) { }
+			HashTableIterator(const HashTableIterator<Table, IsConst>& it) : _ctrl(it._ctrl), _slot(it._slot) { }
+			~HashTableIterator() { }
+
+			HashTableIterator<Table, IsConst>& operator=(const HashTableIterator<Table, IsConst>& it)
+			{
+				this->_ctrl = it._ctrl;
+				this->_slot = it._slot;
+				return (*this);
+			}
+
+			// Allow conversion from non-const to const, but not the other way around
+			operator HashTableIterator<Table, true>() { return (HashTableIterator<Table, true>(this->_ctrl, this->_slot)); }
+
+			// Control byte of the slot, so that containers can give it back to the table (eg. erase)
+			typename Table::ctrl_pointer getCtrl() const { return (this->_ctrl); }
+
+			// Move to the first used slot from here (this one included), or to the end
+			HashTableIterator<Table, IsConst>& skipFree()
+			{
+				while (Table::isFree(*this->_ctrl))
+				{
+					++this->_ctrl;
+					++this->_slot;
+				}
+				return (*this);
+			}
+
+			/********** Relational operators **********/
+
+			// *A
+			typename it::reference operator*() const { return (*this->_slot); }
+
+			// A->m, eg. 'it->first' and 'it->second' for map
+			typename it::pointer operator->() const { return (this->_slot); }
+
+			// ++A, stays on end()
+			HashTableIterator<Table, IsConst>& operator++()
+			{
+				if (*this->_ctrl == Table::ctrlEnd)
+					return (*this);
+				++this->_ctrl;
+				++this->_slot;
+				return (this->skipFree());
+			}
+
+			// A++
+			HashTableIterator<Table, IsConst> operator++(int) { HashTableIterator<Table, IsConst> tmp = *this; ++(*this); return (tmp); }
+
+			/********** Friend relational operators, to allow const and non-const mixed **********/
+
+			template <class LTable, bool LIsConst, class RTable, bool RIsConst>
+			friend bool operator==(const HashTableIterator<LTable, LIsConst>& lhs, const HashTableIterator<RTable, RIsConst>& rhs);
+
+			template <class LTable, bool LIsConst, class RTable, bool RIsConst>
+			friend bool operator!=(const HashTableIterator<LTable, LIsConst>& lhs, const HashTableIterator<RTable, RIsConst>& rhs);
+
+	};
+
+	// Control bytes are unique to a slot, no need to compare the slots too
+	template <class LTable, bool LIsConst, class RTable, bool RIsConst>
+	bool operator==(const HashTableIterator<LTable, LIsConst>& lhs, const HashTableIterator<RTable, RIsConst>& rhs)
+	{ return (lhs._ctrl == rhs._ctrl); }
+
+	template <class LTable, bool LIsConst, class RTable, bool RIsConst>
+	bool operator!=(const HashTableIterator<LTable, LIsConst>& lhs, const HashTableIterator<RTable, RIsConst>& rhs)
+	{ return (!(lhs == rhs)); }
+
+}
+
+#endif
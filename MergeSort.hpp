@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 18-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 11:20 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MERGESORT_HPP
+# define MERGESORT_HPP
+
+#include "iterators.hpp"
+
+#include <cstddef>
+
+namespace ft
+{
+	/* Stable bottom up merge sort of an array, with a buffer of the same size. Containers never assign their values
+	   (they are only copy constructed), so what gets sorted is positions of values (pointers, iterators, nodes),
+	   T is copied around a lot and should be cheap. Used by bulk inserts, and by ParallelSort.hpp for each worker */
+	template <class T, class Compare>
+	struct MergeSort
+	{
+		typedef size_t size_type;
+
+		// Merge the sorted a[0, m) and b[0, n) to out. b's are taken only if strictly smaller, that's what keeps it stable
+		static void merge(const T* a, size_type m, const T* b, size_type n, T* out, const Compare& comp)
+		{
+			size_type i = 0;
+			size_type j = 0;
+
+			while (i < m && j < n)
+			{
+				if (comp(b[j], a[i]))
+					*out++ = b[j++];
+				else
+					*out++ = a[i++];
+			}
+			while (i < m)
+				*out++ = a[i++];
+			while (j < n)
+				*out++ = b[j++];
+		}
+
+		// Sort data[lo, hi), runs of width 1, 2, 4... merged back and forth with buffer[lo, hi), the result ends in data
+		static void sortRange(T* data, T* buffer, size_type lo, size_type hi, const Compare& comp)
+		{
+			T* src = data;
+			T* dst = buffer;
+
+			for (size_type width = 1; width < hi - lo; width *= 2)
+			{
+				for (size_type left = lo; left < hi; left += 2 * width)
+				{
+					size_type mid = (left + width < hi) ? left + width : hi;
+					size_type right = (left + 2 * width < hi) ? left + 2 * width : hi;
+
+					merge(src + left, mid - left, src + mid, right - mid, dst + left, comp);
+				}
+				T* tmp = src;
+				src = dst;
+				dst = tmp;
+			}
+			if (src != data)
+			{
+				for (size_type i = lo; i < hi; ++i)
+					data[i] = src[i];
+			}
+		}
+
+		// Sort data[0, n), buffer must have room for n values too. Returns where the result is (data, same as ParallelSort)
+		static T* sort(T* data, T* buffer, size_type n, const Compare& comp)
+		{
+			sortRange(data, buffer, 0, n, comp);
+			return (data);
+		}
+	};
+
+	// Compares positions of values (anything *pos gives a value of) by the key of the values
+	template <class KeyOfValue, class Compare>
+	struct PositionCompare
+	{
+		Compare comp;
+
+		explicit PositionCompare(const Compare& c) : comp(c) { }
+
+		template <class Position>
+		bool operator()(const Position& lhs, const Position& rhs) const
+		{ return (this->comp(KeyOfValue()(*lhs), KeyOfValue()(*rhs))); }
+	};
+
+	/* True if every value of [first, last) goes strictly after the previous one (comp compares positions, see above),
+	   in which case there is nothing to sort nor to drop. n is the number of values read: the whole range if true */
+	template <class ForwardIterator, class Compare>
+	bool isSortedUnique(ForwardIterator first, ForwardIterator last, const Compare& comp, size_t& n)
+	{
+		n = 0;
+		if (first == last)
+			return (true);
+
+		ForwardIterator prev = first;
+		for (++first, n = 1; first != last; ++first, ++prev, ++n)
+		{
+			if (!comp(prev, first))
+				return (false);
+		}
+		return (true);
+	}
+
+	// Reads the values of an array of positions in the order of the array (eg. once sorted), for the buildSorted of trees
+	template <class Position>
+	class PositionValueIterator
+	{
+		private:
+			const Position* _pos;
+
+		public:
+			explicit PositionValueIterator(const Position* pos) : _pos(pos) { }
+
+			typename ft::iterator_traits<Position>::reference operator*() const { return (**this->_pos); }
+			PositionValueIterator& operator++() { ++this->_pos; return (*this); }
+	};
+
+}
+
+#endif
@@ -0,0 +1,352 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 10:12 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODEPOOL_HPP
+# define NODEPOOL_HPP
+
+#include <memory>
+#include <cstddef>
+#include <new>
+
+namespace ft
+{
+	/* Gives nodes from slabs (arrays of nodes allocated in one go) instead of one allocation per node.
+	   Freed nodes go on a free list and are given back first, so insert / erase churn never reaches the allocator.
+	   Memory only goes back to Allocator on release(), which requires every node to be freed first.
+	   Nodes are only allocated, constructing / destroying what's inside is up to the caller */
+	template <class Node, class Allocator = std::allocator<Node> >
+	class NodePool
+	{
+		private:
+			typedef NodePool<Node, Allocator> self_type;
+
+		public:
+			typedef Node		node_type;
+			typedef Node*		node_pointer;
+			typedef Allocator	allocator_type;
+			typedef size_t		size_type;
+
+			struct stats
+			{
+				size_type slabs;	// Slabs allocated
+				size_type capacity;	// Nodes in all slabs (live + free)
+				size_type live;		// Nodes given and not freed yet
+				size_type free;		// Nodes ready to be given without allocating
+			};
+
+		private:
+			// The first node of each slab links the slabs together, so release() can find them
+			struct slab_header
+			{
+				node_pointer	next;
+				size_type		size; // Slab size in nodes, header included
+			};
+
+			// A free node stores the next free node in it's own memory
+			struct free_node
+			{
+				free_node* next;
+			};
+
+			// Slabs double in size, so small trees stay small and big ones don't allocate too often
+			static const size_type minSlabSize = 16;
+			static const size_type maxSlabSize = 4096;
+
+			allocator_type	_alloc;
+
+			node_pointer	_slabs;		// Last allocated slab, linked to the previous ones
+			node_pointer	_firstSlab;	// Oldest slab, end of the slab list, so splice() doesn't walk it
+			node_pointer	_bump;		// Next never given node of the last slab
+			node_pointer	_bumpEnd;	// One past the last node of the last slab
+			free_node*		_freeList;
+			free_node*		_freeTail;	// Same for the free list
+
+			size_type		_nextSlabSize;
+			size_type		_slabCount;
+			size_type		_capacity;
+			size_type		_live;
+			size_type		_freeCount;
+
+			static slab_header* header(node_pointer slab) { return (reinterpret_cast<slab_header*>(slab)); }
+
+			void allocateSlab()
+			{
+				node_pointer slab = this->_alloc.allocate(this->_nextSlabSize);
+
+				header(slab)->next = this->_slabs;
+				header(slab)->size = this->_nextSlabSize;
+				if (this->_slabs == NULL)
+					this->_firstSlab = slab;
+				this->_slabs = slab;
+
+				// Don't push every node on the free list, just hand them out in order
+				this->_bump = slab + 1;
+				this->_bumpEnd = slab + this->_nextSlabSize;
+
+				++this->_slabCount;
+				this->_capacity += this->_nextSlabSize - 1;
+				this->_freeCount += this->_nextSlabSize - 1;
+				if (this->_nextSlabSize < maxSlabSize)
+					this->_nextSlabSize *= 2;
+			}
+
+			// Pool owns memory, copying it would free it twice
+			NodePool(const self_type&);
+			self_type& operator=(const self_type&);
+
+		public:
+			NodePool(const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _slabs(NULL), _firstSlab(NULL), _bump(NULL), _bumpEnd(NULL), _freeList(NULL), _freeTail(NULL),
+			  _nextSlabSize(minSlabSize), _slabCount(0), _capacity(0), _live(0), _freeCount(0) { }
+
+			~NodePool() { this->release(); }
+
+			node_pointer allocate()
+			{
+				node_pointer node;
+
+				if (this->_freeList != NULL)
+				{
+					node = reinterpret_cast<node_pointer>(this->_freeList);
+					this->_freeList = this->_freeList->next;
+					if (this->_freeList == NULL)
+						this->_freeTail = NULL;
+				}
+				else
+				{
+					if (this->_bump == this->_bumpEnd)
+						this->allocateSlab();
+					node = this->_bump++;
+				}
+				--this->_freeCount;
+				++this->_live;
+				return (node);
+			}
+
+			void deallocate(node_pointer node)
+			{
+				this->pushFree(node);
+				++this->_freeCount;
+				--this->_live;
+			}
+
+			/* Take every slab and free node of x, which is left empty. Nodes x gave are ours from now on,
+			   so they can be given back to us. The smaller of the two never given ranges goes on the free list,
+			   so that's at most maxSlabSize nodes, everything else is O(1) */
+			void splice(self_type& x)
+			{
+				if (x._slabs == NULL)
+					return;
+
+				if ((x._bumpEnd - x._bump) > (this->_bumpEnd - this->_bump))
+				{
+					node_pointer tmp = this->_bump;
+					this->_bump = x._bump;
+					x._bump = tmp;
+					tmp = this->_bumpEnd;
+					this->_bumpEnd = x._bumpEnd;
+					x._bumpEnd = tmp;
+				}
+				for (; x._bump != x._bumpEnd; ++x._bump)
+					this->pushFree(x._bump);
+
+				// Their slabs go at the end of ours, their free nodes in front of ours
+				if (this->_slabs == NULL)
+					this->_slabs = x._slabs;
+				else
+					header(this->_firstSlab)->next = x._slabs;
+				this->_firstSlab = x._firstSlab;
+				if (x._freeList != NULL)
+				{
+					x._freeTail->next = this->_freeList;
+					if (this->_freeList == NULL)
+						this->_freeTail = x._freeTail;
+					this->_freeList = x._freeList;
+				}
+
+				if (x._nextSlabSize > this->_nextSlabSize)
+					this->_nextSlabSize = x._nextSlabSize;
+				this->_slabCount += x._slabCount;
+				this->_capacity += x._capacity;
+				this->_live += x._live;
+				this->_freeCount += x._freeCount;
+
+				// x has nothing left, don't let it free anything
+				x._slabs = NULL;
+				x.release();
+			}
+
+			// Give every slab back to the allocator, nothing must be in use anymore
+			void release()
+			{
+				while (this->_slabs != NULL)
+				{
+					node_pointer next = header(this->_slabs)->next;
+					this->_alloc.deallocate(this->_slabs, header(this->_slabs)->size);
+					this->_slabs = next;
+				}
+				this->_firstSlab = NULL;
+				this->_bump = NULL;
+				this->_bumpEnd = NULL;
+				this->_freeList = NULL;
+				this->_freeTail = NULL;
+				this->_nextSlabSize = minSlabSize;
+				this->_slabCount = 0;
+				this->_capacity = 0;
+				this->_live = 0;
+				this->_freeCount = 0;
+			}
+
+			void swap(self_type& x)
+			{
+				self_type tmp;
+
+				tmp.copyState(*this);
+				this->copyState(x);
+				x.copyState(tmp);
+				tmp._slabs = NULL; // Don't let tmp destructor free what now belongs to x
+			}
+
+			stats getStats() const
+			{
+				stats ret;
+
+				ret.slabs = this->_slabCount;
+				ret.capacity = this->_capacity;
+				ret.live = this->_live;
+				ret.free = this->_freeCount;
+				return (ret);
+			}
+
+			size_type max_size() const { return (this->_alloc.max_size()); }
+
+		private:
+			// Not counted, callers know if it's a freed node or one never given
+			void pushFree(node_pointer node)
+			{
+				free_node* freed = reinterpret_cast<free_node*>(node);
+
+				freed->next = this->_freeList;
+				if (this->_freeList == NULL)
+					this->_freeTail = freed;
+				this->_freeList = freed;
+			}
+
+			void copyState(const self_type& x)
+			{
+				this->_alloc = x._alloc;
+				this->_slabs = x._slabs;
+				this->_firstSlab = x._firstSlab;
+				this->_bump = x._bump;
+				this->_bumpEnd = x._bumpEnd;
+				this->_freeList = x._freeList;
+				this->_freeTail = x._freeTail;
+				this->_nextSlabSize = x._nextSlabSize;
+				this->_slabCount = x._slabCount;
+				this->_capacity = x._capacity;
+				this->_live = x._live;
+				this->_freeCount = x._freeCount;
+			}
+	};
+
+	/* NodePool several trees use at once, once they gave nodes to each other (split / join).
+	   Reference counted, the last user frees it. merge() gives all the memory of a pool to another one,
+	   the emptied pool then forwards to that one, so users still pointing to it end up on the right pool (see resolve) */
+	template <class Node, class Allocator = std::allocator<Node> >
+	class SharedNodePool
+	{
+		private:
+			typedef SharedNodePool<Node, Allocator> self_type;
+			typedef typename Allocator::template rebind<self_type>::other self_allocator_type;
+
+		public:
+			typedef NodePool<Node, Allocator>		pool_type;
+			typedef typename pool_type::size_type	size_type;
+
+		private:
+			pool_type	_pool;
+			size_type	_users;
+			self_type*	_forward; // Pool that took our memory, NULL while we still have it
+
+			explicit SharedNodePool(const Allocator& alloc) : _pool(alloc), _users(1), _forward(NULL) { }
+
+			// Only created / destroyed by the static functions, and never copied
+			SharedNodePool(const self_type&);
+			self_type& operator=(const self_type&);
+
+		public:
+			// New pool with a single user
+			static self_type* create(const Allocator& alloc = Allocator())
+			{
+				self_type* p = self_allocator_type().allocate(1);
+
+				::new (static_cast<void*>(p)) self_type(alloc);
+				return (p);
+			}
+
+			static self_type* acquire(self_type* p)
+			{
+				++p->_users;
+				return (p);
+			}
+
+			// One user less, the last one frees the pool and it's memory, and leaves the pool it forwarded to
+			static void release(self_type* p)
+			{
+				while (p != NULL && --p->_users == 0)
+				{
+					self_type* next = p->_forward;
+
+					p->~SharedNodePool();
+					self_allocator_type().deallocate(p, 1);
+					p = next;
+				}
+			}
+
+			// Follow forwards, p ends up on the pool really holding the memory
+			static self_type* resolve(self_type*& p)
+			{
+				while (p->_forward != NULL)
+				{
+					self_type* next = acquire(p->_forward);
+
+					release(p);
+					p = next;
+				}
+				return (p);
+			}
+
+			// Same without updating anything, for const users
+			static const self_type* resolved(const self_type* p)
+			{
+				while (p->_forward != NULL)
+					p = p->_forward;
+				return (p);
+			}
+
+			// into takes all the memory of from, both must be resolved and different
+			static void merge(self_type* into, self_type* from)
+			{
+				into->_pool.splice(from->_pool);
+				from->_forward = acquire(into);
+			}
+
+			// Other users may have nodes in it, so it can't be freed all at once
+			bool shared() const { return (this->_users > 1); }
+
+			pool_type& pool() { return (this->_pool); }
+			const pool_type& pool() const { return (this->_pool); }
+	};
+
+}
+
+#endif
@@ -0,0 +1,249 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 18-10-2026 11:25 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLELSORT_HPP
+# define PARALLELSORT_HPP
+
+#include "MergeSort.hpp"
+
+#include <memory>
+#include <cstddef>
+#include <pthread.h> // Link with -pthread
+#include <unistd.h> // sysconf
+
+namespace ft
+{
+	/* Stable merge sort of an array on worker threads, for bulk loads (see RedBlackTree::bulkLoad, unless
+	   FT_NO_PARALLEL_BULK_INSERT). Each worker sorts it's own chunk of the array, then every round merges pairs of sorted runs in runs twice as long
+	   until one is left. All workers share every merge of a round: the output of a merge is cut in equal parts and
+	   where a part starts in both runs is found by binary search (co-rank), so nobody does the last merge alone.
+	   T is copied around a lot, so it should be cheap (eg. pointers), Compare is only ever called through const copies */
+	template <class T, class Compare>
+	class ParallelSort
+	{
+		public:
+			typedef size_t size_type;
+
+			// Chunks smaller than this are not worth a thread
+			static const size_type minChunk = 4096;
+
+		private:
+			struct Worker
+			{
+				ParallelSort*	sorter;
+				size_type		id;
+				pthread_t		thread;
+			};
+
+			T*				_data;
+			T*				_buffer;
+			size_type		_size;
+			const Compare	_comp;
+			size_type		_threads; // Workers really running, the calling thread is worker 0
+
+			// Workers wait for each other between rounds, by hand since pthread_barrier_t is not everywhere (eg. macOS)
+			pthread_mutex_t	_mutex;
+			pthread_cond_t	_cond;
+			bool			_started; // Workers don't know how many they are until every thread is created
+			size_type		_waiting;
+			size_type		_generation; // Tells the wake up of a round from a spurious one
+
+			ParallelSort(T* data, T* buffer, size_type n, const Compare& comp)
+			: _data(data), _buffer(buffer), _size(n), _comp(comp), _threads(1), _started(false), _waiting(0), _generation(0)
+			{
+				pthread_mutex_init(&this->_mutex, NULL);
+				pthread_cond_init(&this->_cond, NULL);
+			}
+
+			~ParallelSort()
+			{
+				pthread_cond_destroy(&this->_cond);
+				pthread_mutex_destroy(&this->_mutex);
+			}
+
+			// First index of a worker's chunk, chunks differ by at most one value
+			size_type chunkBegin(size_type chunk) const
+			{
+				if (chunk >= this->_threads)
+					return (this->_size);
+				return (chunk * this->_size / this->_threads);
+			}
+
+			/* Number of values taken from a (of size m) in the first k values of the merge of a and b (of size n).
+			   Out of equal values a's go first, that's what keeps the sort stable. O(log k) */
+			size_type coRank(size_type k, const T* a, size_type m, const T* b, size_type n) const
+			{
+				size_type i = (k < m) ? k : m;
+				size_type j = k - i;
+				size_type iLow = (k > n) ? k - n : 0;
+				size_type jLow = (k > m) ? k - m : 0;
+
+				while (true)
+				{
+					if (i > 0 && j < n && this->_comp(b[j], a[i - 1]))
+					{
+						// a[i - 1] goes after b[j], too much of a
+						size_type delta = (i - iLow + 1) / 2;
+						jLow = j;
+						i -= delta;
+						j += delta;
+					}
+					else if (j > 0 && i < m && !this->_comp(b[j - 1], a[i]))
+					{
+						// a[i] goes before b[j - 1] (or is equal, so still before), not enough of a
+						size_type delta = (j - jLow + 1) / 2;
+						iLow = i;
+						i += delta;
+						j -= delta;
+					}
+					else
+						return (i);
+				}
+			}
+
+			// Write [outLo, outHi) of the merge of src's runs [lo, mid) and [mid, hi) to the same place in dst
+			void mergePart(const T* src, T* dst, size_type lo, size_type mid, size_type hi, size_type outLo, size_type outHi) const
+			{
+				const T* a = src + lo;
+				const T* b = src + mid;
+				size_type m = mid - lo;
+				size_type n = hi - mid;
+				size_type i = this->coRank(outLo - lo, a, m, b, n);
+				size_type j = outLo - lo - i;
+				size_type iEnd = this->coRank(outHi - lo, a, m, b, n);
+				size_type jEnd = outHi - lo - iEnd;
+
+				MergeSort<T, Compare>::merge(a + i, iEnd - i, b + j, jEnd - j, dst + outLo, this->_comp);
+			}
+
+			// Single threaded merge sort of the worker's chunk, ends in data
+			void sortChunk(size_type id)
+			{ MergeSort<T, Compare>::sortRange(this->_data, this->_buffer, this->chunkBegin(id), this->chunkBegin(id + 1), this->_comp); }
+
+			// Returns once every worker called it
+			void wait()
+			{
+				pthread_mutex_lock(&this->_mutex);
+				size_type generation = this->_generation;
+				if (++this->_waiting == this->_threads)
+				{
+					this->_waiting = 0;
+					++this->_generation;
+					pthread_cond_broadcast(&this->_cond);
+				}
+				else
+				{
+					while (generation == this->_generation)
+						pthread_cond_wait(&this->_cond, &this->_mutex);
+				}
+				pthread_mutex_unlock(&this->_mutex);
+			}
+
+			/* What worker id does. In a round where runs are width chunks long, runs are merged by groups of 2 * width
+			   workers (the ones whose chunks are in the 2 runs), each writing an equal part of the merged run.
+			   The last group may have a single run, merged with nothing, so just copied */
+			void run(size_type id)
+			{
+				pthread_mutex_lock(&this->_mutex);
+				while (!this->_started)
+					pthread_cond_wait(&this->_cond, &this->_mutex);
+				pthread_mutex_unlock(&this->_mutex);
+
+				this->sortChunk(id);
+				this->wait();
+
+				T* src = this->_data;
+				T* dst = this->_buffer;
+				for (size_type width = 1; width < this->_threads; width *= 2)
+				{
+					size_type first = id - id % (2 * width); // First worker of the group
+					size_type members = (first + 2 * width < this->_threads) ? 2 * width : this->_threads - first;
+					size_type lo = this->chunkBegin(first);
+					size_type mid = this->chunkBegin(first + width);
+					size_type hi = this->chunkBegin(first + 2 * width);
+					size_type rank = id - first;
+
+					this->mergePart(src, dst, lo, mid, hi,
+									lo + (hi - lo) * rank / members, lo + (hi - lo) * (rank + 1) / members);
+					this->wait();
+
+					T* tmp = src;
+					src = dst;
+					dst = tmp;
+				}
+			}
+
+			static void* work(void* arg)
+			{
+				Worker* worker = static_cast<Worker*>(arg);
+
+				worker->sorter->run(worker->id);
+				return (NULL);
+			}
+
+		public:
+			// One per core, 1 if we can't tell
+			static size_type hardwareThreads()
+			{
+				long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+				return ((cores > 0) ? static_cast<size_type>(cores) : 1);
+			}
+
+			/* Sort data[0, n), buffer must have room for n values too. Returns the one of the two holding the result.
+			   threads is the number of workers (0 for one per core), less are used for small arrays,
+			   and if some threads can't be created the sort still goes on with the others */
+			static T* sort(T* data, T* buffer, size_type n, const Compare& comp, size_type threads = 0)
+			{
+				if (threads == 0)
+					threads = hardwareThreads();
+				if (threads > n / minChunk)
+					threads = (n / minChunk > 0) ? n / minChunk : 1;
+				// Nothing to share, no thread to start
+				if (threads == 1)
+					return (MergeSort<T, Compare>::sort(data, buffer, n, comp));
+
+				ParallelSort sorter(data, buffer, n, comp);
+				std::allocator<Worker> workerAlloc;
+				Worker* workers = workerAlloc.allocate(threads);
+				size_type created = 0;
+
+				// Hold the start until we know how many workers there really are
+				pthread_mutex_lock(&sorter._mutex);
+				for (size_type id = 1; id < threads; ++id, ++created)
+				{
+					workers[id].sorter = &sorter;
+					workers[id].id = id;
+					if (pthread_create(&workers[id].thread, NULL, &ParallelSort::work, &workers[id]) != 0)
+						break;
+				}
+				sorter._threads = created + 1;
+				sorter._started = true;
+				pthread_cond_broadcast(&sorter._cond);
+				pthread_mutex_unlock(&sorter._mutex);
+
+				sorter.run(0);
+				for (size_type id = 1; id <= created; ++id)
+					pthread_join(workers[id].thread, NULL);
+				workerAlloc.deallocate(workers, threads);
+
+				// Each round went from one array to the other
+				size_type rounds = 0;
+				for (size_type width = 1; width < sorter._threads; width *= 2)
+					++rounds;
+				return ((rounds % 2 == 0) ? data : buffer);
+			}
+	};
+
+}
+
+#endif
@@ -14,24 +14,34 @@
 # define REDBLACKTREE_HPP
 
 #include "TreeIterator.hpp"
+#include "pairs.hpp"
+#include "NodePool.hpp"
+#include "MergeSort.hpp"
+#ifndef FT_NO_PARALLEL_BULK_INSERT
+# include "ParallelSort.hpp" // Threads for bulkLoad, link with -pthread (FT_NO_PARALLEL_BULK_INSERT to go without)
+#endif
 
 #include <memory>
 #include <functional>
 #include <iostream>
+#include <stdint.h> // uintptr_t for FT_COMPACT_NODES
 
 #define BLACK 0
 #define RED 1
 
 namespace ft
 {
-	// RedBlackTree class with iterator, can only store UNIQUE values
-	template <class T, class Compare = std::less<T>, class Allocator = std::allocator<T> >
+	/* RedBlackTree class with iterator, can only store values with UNIQUE keys
+	   Stores T values, ordered by their Key, which KeyOfValue()(value) gives (eg. ft::identity for set, ft::select_first for map),
+	   so that searching only needs a key, not a whole value */
+	template <class Key, class T, class KeyOfValue, class Compare = std::less<Key>, class Allocator = std::allocator<T> >
 	class RedBlackTree
 	{
 		private:
-			typedef RedBlackTree<T, Compare, Allocator> self_type;
+			typedef RedBlackTree<Key, T, KeyOfValue, Compare, Allocator> self_type;
 
 		public:
+			typedef Key											key_type;
 			typedef T											value_type;
 			typedef Allocator									allocator_type;
 
@@ -49,22 +59,61 @@ namespace ft
 			typedef ptrdiff_t	difference_type;
 			typedef size_t		size_type;
 
-			typedef Compare data_compare;
+			typedef Compare key_compare;
 
 		public:
+			/* Parent and color are only reached through getParent / setParent / getColor / setColor, so that with
+			   FT_COMPACT_NODES defined the color (RED, BLACK or END_NODE_COLOR for the header) can live in the 2 low bits
+			   of the parent pointer, which are always 0 since nodes are at least pointer aligned.
+			   Saves the color char and it's padding, so a whole word per node (eg. 40 -> 32 bytes for a map<int, int>) */
 			struct node
 			{
+			#ifdef FT_COMPACT_NODES
+				uintptr_t parentAndColor;
+			#else
 				node* parent;
+			#endif
 				node* left;
 				node* right;
 
 				value_type data;
 
-				bool color;
+			#ifndef FT_COMPACT_NODES
+				char color; // RED, BLACK or END_NODE_COLOR for the header
+			#endif
 
-				node() : parent(NULL), left(NULL), right(NULL), data(), color(RED) { }
-				node(reference val) : parent(NULL), left(NULL), right(NULL), data(val), color(RED) { }
-				node(const node& n) : parent(n.parent), left(n.left), right(n.right), data(n.data), color(n.color) { }
+			#ifdef FT_ORDER_STATISTICS
+				size_type count; // Nodes in the subtree rooted here (this one included), meaningless for the header
+			#endif
+
+			#ifdef FT_COMPACT_NODES
+				static const uintptr_t colorMask = 3;
+
+				node* getParent() const { return (reinterpret_cast<node*>(this->parentAndColor & ~colorMask)); }
+				char getColor() const { return (static_cast<char>(this->parentAndColor & colorMask)); }
+
+				void setParent(node* p)
+				{ this->parentAndColor = reinterpret_cast<uintptr_t>(p) | (this->parentAndColor & colorMask); }
+
+				void setColor(char c)
+				{ this->parentAndColor = (this->parentAndColor & ~colorMask) | static_cast<uintptr_t>(c); }
+
+				// Set both without reading the old ones, for freshly allocated nodes
+				void reset(node* p, char c)
+				{ this->parentAndColor = reinterpret_cast<uintptr_t>(p) | static_cast<uintptr_t>(c); }
+			#else
+				node* getParent() const { return (this->parent); }
+				char getColor() const { return (this->color); }
+
+				void setParent(node* p) { this->parent = p; }
+				void setColor(char c) { this->color = c; }
+
+				void reset(node* p, char c)
+				{
+					this->parent = p;
+					this->color = c;
+				}
+			#endif
 			};
 
 			typedef node* node_pointer;
@@ -72,59 +121,162 @@ namespace ft
 		private:
 			
 			typedef std::allocator<node> node_allocator_type;
+			typedef NodePool<node, node_allocator_type> node_pool_type;
+			typedef SharedNodePool<node, node_allocator_type> shared_pool_type;
+
+		public:
+			typedef typename node_pool_type::stats pool_stats;
 
+		private:
 			allocator_type		_alloc; // To allocate T
-			node_allocator_type	_nodeAlloc; // To allocate new node
-			data_compare		_comp; // To compare data for insertion / deletion / search
+			node_allocator_type	_nodeAlloc; // To allocate the header
+			shared_pool_type*	_pool; // To allocate new node, recycles the removed ones (NULL until the first node, shared after split / join)
+			bool				_keepNodes; // If true, clear() keeps the pool slabs for the next fill
+			key_compare			_comp; // To compare keys for insertion / deletion / search, only called through compare()
+			mutable size_type	_compCount; // Comparator calls made by this tree, only counted with FT_COUNT_COMPARISONS
 	
-			node_pointer _root;
-			node_pointer _dummyEnd; // Dummy end for end() iterator
-			
+			/* Header (sentinel) node, it's also the end() node:
+			   header->parent is the root, header->left the smallest node and header->right the biggest one,
+			   and root->parent points back to the header. When the tree is empty left and right point to the header itself */
+			node_pointer _header;
+			// Number of values stored, kept up to date so size() doesn't walk the tree
+			size_type	_size;
+
+			node_pointer root() const { return (this->_header->getParent()); }
+			void setRoot(node_pointer node) { this->_header->setParent(node); }
+			node_pointer& leftmost() const { return (this->_header->left); }
+			node_pointer& rightmost() const { return (this->_header->right); }
+
+			static const key_type& keyOf(node_pointer node) { return (KeyOfValue()(node->data)); }
+
+			// Reads the values of an array of nodes, to build a tree with copies of them (see buildSorted)
+			class NodeValueIterator
+			{
+				private:
+					const node_pointer* _pos;
+
+				public:
+					explicit NodeValueIterator(const node_pointer* pos) : _pos(pos) { }
+
+					const value_type& operator*() const { return ((*this->_pos)->data); }
+					NodeValueIterator& operator++() { ++this->_pos; return (*this); }
+			};
+
+			// Orders nodes by key for the bulk load sort. Not through compare(), the worker threads would race on the counter
+			struct NodeCompare
+			{
+				key_compare comp;
+
+				explicit NodeCompare(const key_compare& c) : comp(c) { }
+
+				bool operator()(node_pointer lhs, node_pointer rhs) const
+				{ return (this->comp(KeyOfValue()(lhs->data), KeyOfValue()(rhs->data))); }
+			};
+
+			// Pool really holding our nodes, created if we don't have one yet
+			shared_pool_type* sharedPool()
+			{
+				if (this->_pool == NULL)
+					this->_pool = shared_pool_type::create();
+				return (shared_pool_type::resolve(this->_pool));
+			}
+
+			node_pool_type& pool() { return (this->sharedPool()->pool()); }
+
+			// Trees we took nodes from may still use it, so it's only freed when the last one lets it go
+			void dropPool()
+			{
+				shared_pool_type::release(this->_pool);
+				this->_pool = NULL;
+			}
+
+			// This tree and x allocate from the same pool from now on, so nodes can go from one to the other
+			void sharePool(self_type& x)
+			{
+				if (x._pool == NULL)
+				{
+					x._pool = shared_pool_type::acquire(this->sharedPool());
+					return;
+				}
+				if (this->_pool == NULL)
+				{
+					this->_pool = shared_pool_type::acquire(x.sharedPool());
+					return;
+				}
+				if (this->sharedPool() != x.sharedPool())
+					shared_pool_type::merge(this->sharedPool(), x.sharedPool());
+			}
+
+			/* Every comparison of the tree goes through here, define FT_COUNT_COMPARISONS before including to count them
+			   (off by default so it costs nothing), see comparisons() */
+			bool compare(const key_type& lhs, const key_type& rhs) const
+			{
+			#ifdef FT_COUNT_COMPARISONS
+				++this->_compCount;
+			#endif
+				return (this->_comp(lhs, rhs));
+			}
+
+			/* Order statistics, with FT_ORDER_STATISTICS defined before including, every node knows how many nodes are in
+			   it's subtree, which is enough to find the k-th node or the position of a node in O(log n).
+			   Rotations, insert and remove keep counts right, these are no-ops otherwise */
+		#ifdef FT_ORDER_STATISTICS
+			static size_type subtreeSize(node_pointer node) { return ((node == NULL) ? 0 : node->count); }
+
+			static void updateCount(node_pointer node)
+			{ node->count = 1 + subtreeSize(node->left) + subtreeSize(node->right); }
+
+			// One more (or less) node below every node from node up to the root
+			void growPath(node_pointer node)
+			{
+				for (; node != this->_header; node = node->getParent())
+					++node->count;
+			}
+
+			void shrinkPath(node_pointer node)
+			{
+				for (; node != this->_header; node = node->getParent())
+					--node->count;
+			}
+		#else
+			static void updateCount(node_pointer) { }
+			void growPath(node_pointer) { }
+			void shrinkPath(node_pointer) { }
+		#endif
 
 			// Not static since it's type dependant
-			node_pointer createNode(const value_type& value = value_type())
+			node_pointer createNode(const value_type& value)
 			{
 				// Allocate a node but don't call constructor, so that we can construct T with T's alllocator
-				node_pointer newNode = this->_nodeAlloc.allocate(1);
+				node_pointer newNode = this->pool().allocate();
 
 				// Construct the data directly with value, instead of calling default constructor then assigning
 				this->_alloc.construct(&(newNode->data), value);
 
-				newNode->parent = NULL;
+				newNode->reset(NULL, RED);
 				newNode->left = NULL;
 				newNode->right = NULL;
-				newNode->color = RED;
+			#ifdef FT_ORDER_STATISTICS
+				newNode->count = 1;
+			#endif
 
 				return (newNode);
 			}
 
-			void createEndNode()
+			// The header never holds a value, so only allocate it, no need to construct T (which may not even be default constructible)
+			void createHeader()
 			{
-				this->_dummyEnd = this->createNode();
-				this->_dummyEnd->color = END_NODE_COLOR;
+				this->_header = this->_nodeAlloc.allocate(1);
+				this->_header->reset(NULL, END_NODE_COLOR);
+				this->resetHeader();
 			}
 
-			// Set the end node at the end of the tree
-			void setEndNodeAtTheEnd()
+			// Empty tree state, no root, and begin() == end()
+			void resetHeader()
 			{
-				node_pointer curr = this->_root;
-
-				while (curr != NULL && curr->right)
-					curr = curr->right;
-				
-				if (curr != NULL && curr->right != this->_dummyEnd)
-					curr->right = this->_dummyEnd;
-				//else
-				//	this->_root = this->_dummyEnd;
-				this->_dummyEnd->parent = curr;
-			}
-
-			// When seraching / inserting, hide the node from the tree
-			void vanishEndNode()
-			{
-				if (this->_dummyEnd->parent != NULL)
-					this->_dummyEnd->parent->right = NULL;
-				this->_dummyEnd->parent = NULL;
+				this->_header->setParent(NULL);
+				this->_header->left = this->_header;
+				this->_header->right = this->_header;
 			}
 
 			void deleteNode(node_pointer node)
@@ -134,14 +286,14 @@ namespace ft
 
 				// Only special case of deletion is when we delete the root
 				// because it's the only node we keep track off, reset it when destroyed
-				if (node == this->_root)
-					this->_root = NULL;
+				if (node == this->root())
+					this->setRoot(NULL);
 
 				// Call destructor on the data
 				this->_alloc.destroy(&(node->data));
 
-				// Since nothing else need to be manually destroyed, just deallocate
-				this->_nodeAlloc.deallocate(node, 1);
+				// Since nothing else need to be manually destroyed, just give it back to the pool
+				this->pool().deallocate(node);
 			}
 
 			// See https://algorithmtutor.com/Data-Structures/Tree/Red-Black-Trees/
@@ -168,20 +320,24 @@ namespace ft
 				// Switch Y.left and X.right
 				node->left = newNode->right;			// Y.left = b
 				if (newNode->right != NULL)
-					newNode->right->parent = node;		// b.parent = Y (to complete Y.left = b)
+					newNode->right->setParent(node);		// b.parent = Y (to complete Y.left = b)
 
 				// Redirect old links from X to Y
-				newNode->parent = node->parent;			// X.parent = Y.parent (since we switch X and Y)
-				if (node->parent == NULL)				// node is the root (same as node == this->_root)
-					this->_root = newNode;				// root = X
-				else if (node == node->parent->right)	// Y is the right child
-					node->parent->right = newNode;		// Modify parent to point to X
+				newNode->setParent(node->getParent());	// X.parent = Y.parent (since we switch X and Y)
+				if (node == this->root())				// node is the root (it's parent is the header)
+					this->setRoot(newNode);				// root = X
+				else if (node == node->getParent()->right)	// Y is the right child
+					node->getParent()->right = newNode;		// Modify parent to point to X
 				else									// Y is the left child
-					node->parent->left = newNode;		// Modify parent to point to X
+					node->getParent()->left = newNode;		// Modify parent to point to X
 
 				// Change links between X and Y
 				newNode->right = node;					// X.right = Y
-				node->parent = newNode;					// Y.parent = X
+				node->setParent(newNode);					// Y.parent = X
+
+				// Y is now below X, so count it first
+				updateCount(node);
+				updateCount(newNode);
 			}
 
 			/* Rotate node n left, makes it become the child and it's right child the parent 
@@ -207,458 +363,1398 @@ namespace ft
 				// Switch X.right and Y.left
 				node->right = newNode->left;			// Y.left = b
 				if (newNode->left != NULL)
-					newNode->left->parent = node;		// b.parent = Y (to complete Y.left = b)
+					newNode->left->setParent(node);		// b.parent = Y (to complete Y.left = b)
 
 				// Redirect old links from X to Y
-				newNode->parent = node->parent;			// X.parent = Y.parent (since we switch X and Y)
-				if (node->parent == NULL)				// node is the root (same as node == this->_root)
-					this->_root = newNode;				// root = X
-				else if (node == node->parent->left)	// Y is the left child
-					node->parent->left = newNode;		// Modify parent to point to X
+				newNode->setParent(node->getParent());	// X.parent = Y.parent (since we switch X and Y)
+				if (node == this->root())				// node is the root (it's parent is the header)
+					this->setRoot(newNode);				// root = X
+				else if (node == node->getParent()->left)	// Y is the left child
+					node->getParent()->left = newNode;		// Modify parent to point to X
 				else									// Y is the left child
-					node->parent->right = newNode;		// Modify parent to point to X
+					node->getParent()->right = newNode;		// Modify parent to point to X
 
 				// Change links between X and Y
 				newNode->left = node;					// X.right = Y
-				node->parent = newNode;					// Y.parent = X
+				node->setParent(newNode);					// Y.parent = X
+
+				updateCount(node);
+				updateCount(newNode);
 			}
 
 			// As the name says, fix all violations, takes the newly added node, all the way up
-			void fixInsertionViolations(node_pointer node)
+			// Returns true if the black height of the tree grew (only join cares)
+			bool fixInsertionViolations(node_pointer node)
 			{
 				node_pointer	uncle;
 
 				// Start from newly inserted node all the way up, since we put parent RED each time
-				while (node->parent->color == RED)
+				// Root's parent is the header which is never RED, so we can't go past the root
+				while (node->getParent()->getColor() == RED)
 				{
-					if (node->parent == node->parent->parent->right) // Node parent is the right node of grand-parent 
+					if (node->getParent() == node->getParent()->getParent()->right) // Node parent is the right node of grand-parent 
 					{
-						uncle = node->parent->parent->left;
-						if (uncle && uncle->color == RED) // Uncle red, switch colors
+						uncle = node->getParent()->getParent()->left;
+						if (uncle && uncle->getColor() == RED) // Uncle red, switch colors
 						{
-							uncle->color = BLACK;
-							node->parent->color = BLACK;
-							node->parent->parent->color = RED;
-							node = node->parent->parent;
+							uncle->setColor(BLACK);
+							node->getParent()->setColor(BLACK);
+							node->getParent()->getParent()->setColor(RED);
+							node = node->getParent()->getParent();
 						}
 						else // Uncle black, set parent black and grand-parent red and rotate
 						{
-							if (node == node->parent->left)
+							if (node == node->getParent()->left)
 							{
-								node = node->parent; // parent will re-become child after rotate
+								node = node->getParent(); // parent will re-become child after rotate
 								rightRotate(node);
 							}
-							node->parent->color = BLACK;		// This still be parent after left rotate, so make it black since node is red
-							node->parent->parent->color = RED;	// Grand-parent will become sibling, so make it red since node is red
-							leftRotate(node->parent->parent);
+							node->getParent()->setColor(BLACK);		// This still be parent after left rotate, so make it black since node is red
+							node->getParent()->getParent()->setColor(RED);	// Grand-parent will become sibling, so make it red since node is red
+							leftRotate(node->getParent()->getParent());
 						}
 					}
 					else // Node parent is the left node of grand-parent => mirror scenario
 					{
-						uncle = node->parent->parent->right;
-						if (uncle && uncle->color == RED) // Uncle red, switch colors
+						uncle = node->getParent()->getParent()->right;
+						if (uncle && uncle->getColor() == RED) // Uncle red, switch colors
 						{
-							uncle->color = BLACK;
-							node->parent->color = BLACK;
-							node->parent->parent->color = RED;
-							node = node->parent->parent;
+							uncle->setColor(BLACK);
+							node->getParent()->setColor(BLACK);
+							node->getParent()->getParent()->setColor(RED);
+							node = node->getParent()->getParent();
 						}
 						else
 						{
-							if (node == node->parent->right)
+							if (node == node->getParent()->right)
 							{
-								node = node->parent; // parent will re-become child after rotate
+								node = node->getParent(); // parent will re-become child after rotate
 								leftRotate(node);
 							}
-							node->parent->color = BLACK;		// This still be parent after left rotate, so make it black since node is red
-							node->parent->parent->color = RED;	// Grand-parent will become sibling, so make it red since node is red
+							node->getParent()->setColor(BLACK);		// This still be parent after left rotate, so make it black since node is red
+							node->getParent()->getParent()->setColor(RED);	// Grand-parent will become sibling, so make it red since node is red
 
-							rightRotate(node->parent->parent);
+							rightRotate(node->getParent()->getParent());
 						}
 					}
-					if (node == this->_root)
+					if (node == this->root())
 						break;
 				}
-				this->_root->color = BLACK;
+				// Root is only RED if recoloring went all the way up, making it BLACK adds one black to every path
+				bool grew = (this->root()->getColor() == RED);
+				this->root()->setColor(BLACK);
+				return (grew);
 			}
 
-			void fixDeleteViolations(node_pointer node)
+			// NULL leaves count as BLACK
+			static bool isBlack(node_pointer node) { return (node == NULL || node->getColor() == BLACK); }
+
+			// node may be NULL (removed node had no child), so we also need it's parent to know where we are
+			void fixDeleteViolations(node_pointer node, node_pointer parent)
 			{
-				if (node == NULL)
-					return;
-					
 				node_pointer sibling = NULL;
-				while (node != this->_root && node->color == BLACK)
+				while (node != this->root() && isBlack(node))
 				{
-					if (node == node->parent->left)
+					if (node == parent->left)
 					{
-						sibling = node->parent->right;
-						if (sibling->color == RED)
+						sibling = parent->right;
+						if (sibling->getColor() == RED)
 						{
-							sibling->color = BLACK;
-							node->parent->color = RED;
-							leftRotate(node->parent);
-							sibling = node->parent->right;
+							sibling->setColor(BLACK);
+							parent->setColor(RED);
+							leftRotate(parent);
+							sibling = parent->right;
 						}
 
-						if (sibling->left->color == BLACK && sibling->right->color == BLACK)
+						if (isBlack(sibling->left) && isBlack(sibling->right))
 						{
-							sibling->color = RED;
-							node = node->parent;
+							sibling->setColor(RED);
+							node = parent;
+							parent = parent->getParent();
 						}
 						else
 						{
-							if (sibling->right->color == BLACK)
+							if (isBlack(sibling->right))
 							{
-								sibling->left->color = BLACK;
-								sibling->color = RED;
+								sibling->left->setColor(BLACK);
+								sibling->setColor(RED);
 								rightRotate(sibling);
-								sibling = node->parent->right;
+								sibling = parent->right;
 							}
 
-							sibling->color = node->parent->color;
-							node->parent->color = BLACK;
-							sibling->right->color = BLACK;
-							leftRotate(node->parent);
-							node = this->_root;
+							sibling->setColor(parent->getColor());
+							parent->setColor(BLACK);
+							sibling->right->setColor(BLACK);
+							leftRotate(parent);
+							node = this->root();
 						}
 					}
 					else
 					{
-						sibling = node->parent->left;
-						if (sibling->color == RED)
+						sibling = parent->left;
+						if (sibling->getColor() == RED)
 						{
-							sibling->color = BLACK;
-							node->parent->color = RED;
-							rightRotate(node->parent);
-							sibling = node->parent->left;
+							sibling->setColor(BLACK);
+							parent->setColor(RED);
+							rightRotate(parent);
+							sibling = parent->left;
 						}
 
-						if (sibling->left->color == BLACK && sibling->right->color == BLACK)
+						if (isBlack(sibling->left) && isBlack(sibling->right))
 						{
-							sibling->color = RED;
-							node = node->parent;
+							sibling->setColor(RED);
+							node = parent;
+							parent = parent->getParent();
 						}
 						else
 						{
-							if (sibling->left->color == BLACK)
+							if (isBlack(sibling->left))
 							{
-								sibling->right->color = BLACK;
-								sibling->color = RED;
+								sibling->right->setColor(BLACK);
+								sibling->setColor(RED);
 								leftRotate(sibling);
-								sibling = node->parent->left;
+								sibling = parent->left;
 							}
 							
-							sibling->color = node->parent->color;
-							node->parent->color = BLACK;
-							sibling->left->color = BLACK;
-							rightRotate(node->parent);
-							node = this->_root;
+							sibling->setColor(parent->getColor());
+							parent->setColor(BLACK);
+							sibling->left->setColor(BLACK);
+							rightRotate(parent);
+							node = this->root();
 						}
 					}
 				}
-				node->color = BLACK;
+				if (node != NULL)
+					node->setColor(BLACK);
 			}
 
 			// replaces `node` with `replace`
 			void replaceNode(node_pointer node, node_pointer replace)
 			{
 				// Make node parent point to replace
-				if (node == this->_root)
-					this->_root = replace;
-				else if (node == node->parent->left)
-					node->parent->left = replace;
+				if (node == this->root())
+					this->setRoot(replace);
+				else if (node == node->getParent()->left)
+					node->getParent()->left = replace;
 				else
-					node->parent->right = replace;
+					node->getParent()->right = replace;
 
 				// Make replace point to node parent
 				if (replace != NULL)
-					replace->parent = node->parent;
+					replace->setParent(node->getParent());
 			}
 
-			// Size is the size of left tree + 1 (Parent) + size of right tree
-			size_type recursiveSize(node_pointer node) const
+			// Copy of a node value and color, not linked to anything yet
+			node_pointer cloneNode(node_pointer src)
 			{
-				if (node == NULL || node == this->_dummyEnd)
-					return (0);
-				return (recursiveSize(node->left) + 1 + recursiveSize(node->right));
+				node_pointer node = this->createNode(src->data);
+
+				node->setColor(src->getColor());
+			#ifdef FT_ORDER_STATISTICS
+				node->count = src->count;
+			#endif
+				return (node);
 			}
 
-			// Clears the tree from left to right, from leaves to root
-			void recursiveClear(node_pointer node)
+			/* Copy src subtree as is (same shape, same colors) under parent, no comparison nor rebalancing needed
+			   Only recurse on right children and loop on left ones, so recursion depth is at most the tree height */
+			node_pointer cloneSubtree(node_pointer src, node_pointer parent)
 			{
-				if (node == NULL || node == this->_dummyEnd)
+				node_pointer top = this->cloneNode(src);
+
+				top->setParent(parent);
+				if (src->right != NULL)
+					top->right = this->cloneSubtree(src->right, top);
+
+				parent = top;
+				src = src->left;
+				while (src != NULL)
+				{
+					node_pointer node = this->cloneNode(src);
+
+					parent->left = node;
+					node->setParent(parent);
+					if (src->right != NULL)
+						node->right = this->cloneSubtree(src->right, node);
+					parent = node;
+					src = src->left;
+				}
+				return (top);
+			}
+
+			// O(n) copy of tree into this one, which must be empty
+			void copyFrom(const self_type& tree)
+			{
+				if (tree.root() == NULL)
 					return;
 
-				recursiveClear(node->left);
-				recursiveClear(node->right);
+				this->setRoot(this->cloneSubtree(tree.root(), this->_header));
+				this->leftmost() = minimum(this->root());
+				this->rightmost() = maximum(this->root());
+				this->_size = tree.size();
+			}
+
+			// Values are copied in new nodes, but an array of our own nodes is relinked as it is (see merge)
+			template <class ForwardIterator>
+			node_pointer takeNode(ForwardIterator& it) { return (this->createNode(*it)); }
 
-				this->deleteNode(node);
+			node_pointer takeNode(node_pointer* it) { return (*it); }
+
+			/* Build a subtree from the n next (sorted) values of first, left half first so values are read in order.
+			   Halves differ by at most one node, so every level is full except maybe the deepest one,
+			   coloring only that level RED keeps the same black height on every path */
+			template <class ForwardIterator>
+			node_pointer buildSortedSubtree(ForwardIterator& first, size_type n, size_type depth, size_type redDepth, node_pointer parent)
+			{
+				if (n == 0)
+					return (NULL);
+
+				size_type leftSize = (n - 1) / 2;
+				node_pointer left = this->buildSortedSubtree(first, leftSize, depth + 1, redDepth, NULL);
+
+				node_pointer node = this->takeNode(first);
+				++first;
+				node->setParent(parent);
+				node->setColor((depth == redDepth) ? RED : BLACK);
+			#ifdef FT_ORDER_STATISTICS
+				node->count = n;
+			#endif
+				node->left = left;
+				if (left != NULL)
+					left->setParent(node);
+				node->right = this->buildSortedSubtree(first, n - 1 - leftSize, depth + 1, redDepth, node);
+				return (node);
+			}
+
+			// True if every value of the range goes strictly after the previous one, also counts the range
+			template <class ForwardIterator>
+			bool isSortedUnique(ForwardIterator first, ForwardIterator last, size_type& n) const
+			{
+				n = 0;
+				if (first == last)
+					return (true);
+
+				ForwardIterator prev = first;
+				for (++first, n = 1; first != last; ++first, ++prev, ++n)
+				{
+					if (!this->compare(KeyOfValue()(*prev), KeyOfValue()(*first)))
+						return (false);
+				}
+				return (true);
+			}
+
+			// Single pass iterators, we can't look ahead, so insert one by one (hinted at the end, cheap if sorted)
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				while (first != last)
+					this->insertUnique(this->_header, *first++);
 			}
 
-			// Pretty easy but I'm smartn't so this won't have my monkey brain
-			bool isInf(const value_type& lhs, const value_type& rhs) const
-			{ return (this->_comp(lhs, rhs)); }
+			// If we are empty and the range is sorted, build directly, otherwise fallback to one by one
+			template <class ForwardIterator>
+			void insertRange(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n;
 
-			bool isInfOrEqual(const value_type& lhs, const value_type& rhs) const
-			{ return (this->isInf(lhs, rhs) || this->isEq(lhs, rhs)); }
+				if (this->empty() && this->isSortedUnique(first, last, n))
+					this->buildSorted(first, n);
+				else
+					this->insertRange(first, last, ft::input_iterator_tag());
+			}
 
-			bool isSup(const value_type& lhs, const value_type& rhs) const
-			{ return (!this->isInf(lhs, rhs) && !this->isEq(lhs, rhs)); }
+			// Trusted sorted range, no need to check, only count
+			template <class InputIterator>
+			void insertSortedRange(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{ this->insertRange(first, last, ft::input_iterator_tag()); }
 
-			bool isSupOrEqual(const value_type& lhs, const value_type& rhs) const
-			{ return (this->isSup(lhs, rhs) || this->isEq(lhs, rhs)); }
+			template <class ForwardIterator>
+			void insertSortedRange(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				if (!this->empty())
+					return (this->insertRange(first, last, ft::input_iterator_tag()));
 
-			bool isEq(const value_type& lhs, const value_type& rhs) const
-			{ return (!this->_comp(lhs, rhs) && !this->_comp(rhs, lhs)); }
+				size_type n = 0;
+				for (ForwardIterator it = first; it != last; ++it)
+					++n;
+				this->buildSorted(first, n);
+			}
+
+			// Single pass iterators can't be counted before, so they are inserted one by one
+			template <class InputIterator>
+			void bulkLoad(InputIterator first, InputIterator last, size_type threads, ft::input_iterator_tag)
+			{
+				(void)threads;
+				this->insertRange(first, last, ft::input_iterator_tag());
+			}
+
+			/* Values are copied in new nodes right away (converted to value_type once and for all), then only node pointers
+			   are sorted. Duplicates are next to each other after a stable sort, the first one of the range first */
+			template <class ForwardIterator>
+			void bulkLoad(ForwardIterator first, ForwardIterator last, size_type threads, ft::forward_iterator_tag)
+			{
+				if (!this->empty())
+				{
+					// Built aside and merged in, ours win like they would with insert
+					self_type batch(this->_comp, this->_alloc);
+
+					batch.bulkLoad(first, last, threads, ft::forward_iterator_tag());
+					return (this->merge(batch));
+				}
+
+				size_type n = 0;
+				for (ForwardIterator it = first; it != last; ++it)
+					++n;
+				if (n == 0)
+					return;
+
+				std::allocator<node_pointer> arrayAlloc;
+				node_pointer* nodes = arrayAlloc.allocate(2 * n); // Values then sort buffer
+				for (size_type i = 0; i < n; ++i, ++first)
+					nodes[i] = this->createNode(*first);
+
+			#ifndef FT_NO_PARALLEL_BULK_INSERT
+				node_pointer* sorted = ParallelSort<node_pointer, NodeCompare>::sort(nodes, nodes + n, n, NodeCompare(this->_comp), threads);
+			#else
+				(void)threads;
+				node_pointer* sorted = MergeSort<node_pointer, NodeCompare>::sort(nodes, nodes + n, n, NodeCompare(this->_comp));
+			#endif
+				size_type unique = 1;
+				for (size_type i = 1; i < n; ++i)
+				{
+					if (this->compare(keyOf(sorted[unique - 1]), keyOf(sorted[i])))
+						sorted[unique++] = sorted[i];
+					else
+						this->deleteNode(sorted[i]);
+				}
+				this->buildSorted(sorted, unique);
+				arrayAlloc.deallocate(nodes, 2 * n);
+			}
+
+			/* Destroy every value without recursion nor stack: while a node has a left child, rotate it up (right rotation
+			   without caring about colors / parents since everything goes away), once it has none it can be destroyed and
+			   we continue with it's right child. Each node is rotated at most once, so it's O(n).
+			   If release, nodes are not given back to the pool one by one, the pool frees all it's slabs at once after
+			   (unless other trees still use it, then nodes go back one by one and we just leave the pool) */
+			void destroyNodes(bool release)
+			{
+				node_pointer curr = this->root();
+				bool oneByOne = !release || (curr != NULL && this->sharedPool()->shared());
+
+				while (curr != NULL)
+				{
+					if (curr->left != NULL)
+					{
+						node_pointer left = curr->left;
+
+						curr->left = left->right;
+						left->right = curr;
+						curr = left;
+					}
+					else
+					{
+						node_pointer next = curr->right;
+
+						this->_alloc.destroy(&(curr->data));
+						if (oneByOne)
+							this->pool().deallocate(curr);
+						curr = next;
+					}
+				}
+
+				// Back to the empty state in case we refill the tree after clear
+				this->resetHeader();
+				this->_size = 0;
+
+				if (release)
+					this->dropPool();
+			}
 
 		public:
-			RedBlackTree(const data_compare& comp = data_compare(),
+			RedBlackTree(const key_compare& comp = key_compare(),
 			    		 const allocator_type& alloc = allocator_type())
-			: _alloc(alloc), _nodeAlloc(), _comp(comp), _root(NULL), _dummyEnd(NULL)
+			: _alloc(alloc), _nodeAlloc(), _pool(NULL), _keepNodes(false), _comp(comp), _compCount(0), _header(NULL), _size(0)
 			{
-				this->createEndNode();
+				this->createHeader();
 			}
 
 			RedBlackTree(const self_type& tree)
-			: _alloc(tree._alloc), _nodeAlloc(tree._nodeAlloc), _comp(tree._comp), _root(NULL), _dummyEnd(NULL)
+			: _alloc(tree._alloc), _nodeAlloc(tree._nodeAlloc), _pool(NULL), _keepNodes(tree._keepNodes), _comp(tree._comp), _compCount(0), _header(NULL), _size(0)
 			{
-				this->createEndNode();
-				for (const_iterator it = tree.begin(); it != tree.end(); ++it)
-					this->insert(*it);
+				this->createHeader();
+				this->copyFrom(tree);
 			}
 
 			~RedBlackTree()
 			{
-				this->clear();
+				this->destroyNodes(true);
 
-				this->deleteNode(this->_dummyEnd);
+				// Header data was never constructed, only give the memory back
+				this->_nodeAlloc.deallocate(this->_header, 1);
+			}
+
+			static node_pointer minimum(node_pointer node)
+			{
+				while (node->left != NULL)
+					node = node->left;
+				return (node);
+			}
+
+			static node_pointer maximum(node_pointer node)
+			{
+				while (node->right != NULL)
+					node = node->right;
+				return (node);
 			}
 
 			// https://stackoverflow.com/questions/3381867/iterating-over-a-map/3382702#3382702
+			// Successor of the biggest node is the header (end), successor of the header is itself
 			template <class Node>
 			static node_pointer inorderSuccessor(Node* node)
 			{
-				if (node == NULL)
-					return (NULL);
+				if (node == NULL || node->getColor() == END_NODE_COLOR)
+					return (node);
 
 				// If node has a right child, successor is the smallest value of it's right subtree
 				if (node->right != NULL)
-				{
-					node = node->right;
-					while (node->left != NULL)
-						node = node->left;
-				}
-				else
-				{
-					// In this case the node is on the furthest right of it's subtree,
-					// go up until we find a node that is a left child, successor is this node's parent
-					while (node->parent != NULL && node == node->parent->right)
-						node = node->parent;
-					node = node->parent;
-				}
-
-				return (node);
+					return (minimum(node->right));
+
+				// In this case the node is on the furthest right of it's subtree,
+				// go up until we find a node that is a left child, successor is this node's parent
+				// Root's parent is the header, so coming from the biggest node we end on it
+				while (node->getParent()->getColor() != END_NODE_COLOR && node == node->getParent()->right)
+					node = node->getParent();
+				return (node->getParent());
 			}
 
-			// Basically a mirror of inorderSuccessor
+			// Basically a mirror of inorderSuccessor, predecessor of the header is the biggest node
+			// Returns NULL for the smallest node since nothing is before it
 			template <class Node>
 			static node_pointer inorderPredecessor(Node* node)
 			{
 				if (node == NULL)
 					return (NULL);
 
+				// Header right is the biggest node (or the header itself if the tree is empty)
+				if (node->getColor() == END_NODE_COLOR)
+					return (node->right);
+
 				// If node has a left child, predecessor is the biggest value of it's left subtree
 				if (node->left != NULL)
+					return (maximum(node->left));
+
+				// In this case the node is on the furthest left of it's subtree
+				// go up until we find a node that is a right child, predecessor is this node's parent
+				while (node->getParent()->getColor() != END_NODE_COLOR && node == node->getParent()->left)
+					node = node->getParent();
+				if (node->getParent()->getColor() == END_NODE_COLOR)
+					return (NULL);
+				return (node->getParent());
+			}
+
+			/* Single descent looking for key
+			   Returns the node holding key if there is one, otherwise NULL and sets parent / left to where it should be linked,
+			   so that the caller can then call insertAt without searching again.
+			   Only asks "key < node ?" on the way down (one comparison per level), if key is already there it's the node
+			   right before where the descent ended, so equality costs one more comparison at the end */
+			node_pointer searchInsertPosition(const key_type& key, node_pointer& parent, bool& left) const
+			{
+				node_pointer curr = this->root();
+
+				parent = this->_header; // Empty tree, new node will be the root
+				left = true;
+				while (curr != NULL)
 				{
-					node = node->left;
-					while (node->right != NULL)
-						node = node->right;
+					parent = curr;
+					left = this->compare(key, keyOf(curr));
+					curr = left ? curr->left : curr->right;
 				}
-				else
+				if (parent == this->_header)
+					return (NULL);
+
+				// Biggest node not going after key, nothing is before the smallest one
+				node_pointer before = parent;
+				if (left)
 				{
-					// In this case the node is on the furthest left of it's subtree
-					// go up until we find a node that is a left child, predecessor is this node's parent
-					while (node->parent != NULL && node == node->parent->left)
-						node = node->parent;
-					node = node->parent;
+					if (parent == this->leftmost())
+						return (NULL);
+					before = inorderPredecessor(parent);
 				}
-				
-				return (node);
+				if (this->compare(keyOf(before), key))
+					return (NULL);
+				return (before); // Same key already present
 			}
 
-			// Returns true if value was inserted, false if some was already there
-			bool insert(const value_type& val)
+			/* Same as searchInsertPosition, but first check if key goes right before or right after hint,
+			   in which case we can link it there directly, that's amortized O(1) when inserting sorted values.
+			   If the hint is wrong, fallback to the full descent */
+			node_pointer searchHintPosition(node_pointer hint, const key_type& key, node_pointer& parent, bool& left) const
 			{
-				node_pointer node = this->createNode(val);
-				
-				this->vanishEndNode();
-				
-				if (this->_root == NULL)
+				if (hint == this->_header)
 				{
-					node->color = BLACK;
-					this->_root = node;
-					this->setEndNodeAtTheEnd();
-					return (true);
+					// Hint is end(), it's right if key goes after the biggest value
+					if (!this->empty() && this->compare(keyOf(this->rightmost()), key))
+					{
+						parent = this->rightmost();
+						left = false;
+						return (NULL);
+					}
 				}
-
-				node_pointer curr = this->_root;
-				node_pointer parent = NULL;
-
-				while (curr != NULL)
+				else if (this->compare(key, keyOf(hint)))
 				{
-					parent = curr;
-					if (isInf(node->data, curr->data))
-						curr = curr->left;
-					else if (isSup(node->data, curr->data))
-						curr = curr->right;
-					else // Same value already present
+					// key goes before hint, it should also go after the value before hint
+					if (hint == this->leftmost())
 					{
-						this->setEndNodeAtTheEnd();
-						return (false);
+						parent = hint;
+						left = true;
+						return (NULL);
+					}
+					node_pointer before = inorderPredecessor(hint);
+					if (this->compare(keyOf(before), key))
+					{
+						// before and hint are neighbours, so either before has no right child or hint has no left child
+						if (before->right == NULL)
+						{
+							parent = before;
+							left = false;
+						}
+						else
+						{
+							parent = hint;
+							left = true;
+						}
+						return (NULL);
+					}
+				}
+				else if (this->compare(keyOf(hint), key))
+				{
+					// Mirror, key goes after hint, it should also go before the value after hint
+					if (hint == this->rightmost())
+					{
+						parent = hint;
+						left = false;
+						return (NULL);
+					}
+					node_pointer after = inorderSuccessor(hint);
+					if (this->compare(key, keyOf(after)))
+					{
+						if (hint->right == NULL)
+						{
+							parent = hint;
+							left = false;
+						}
+						else
+						{
+							parent = after;
+							left = true;
+						}
+						return (NULL);
 					}
 				}
-				node->parent = parent;
-				if (isInf(node->data, parent->data))
+				else // Same value as the hint
+					return (hint);
+
+				return (this->searchInsertPosition(key, parent, left));
+			}
+
+			// Link a new node holding val as left / right child of parent (the header meaning it's the new root), then rebalance
+			// Only place where we allocate for insertion, so we only pay for it when the value really gets inserted
+			node_pointer insertAt(node_pointer parent, bool left, const value_type& val)
+			{ return (this->linkNode(parent, left, this->createNode(val))); }
+
+			// Same with a node we already have (eg. unlinked from another tree), only it's value is kept
+			node_pointer linkNode(node_pointer parent, bool left, node_pointer node)
+			{
+				node->reset(parent, RED);
+				node->left = NULL;
+				node->right = NULL;
+			#ifdef FT_ORDER_STATISTICS
+				node->count = 1;
+			#endif
+
+				if (parent == this->_header)
+				{
+					this->setRoot(node);
+					this->leftmost() = node;
+					this->rightmost() = node;
+				}
+				else if (left)
+				{
 					parent->left = node;
+					if (parent == this->leftmost())
+						this->leftmost() = node;
+				}
 				else
+				{
 					parent->right = node;
+					if (parent == this->rightmost())
+						this->rightmost() = node;
+				}
+				this->growPath(parent);
 
 				this->fixInsertionViolations(node);
-				
-				this->setEndNodeAtTheEnd();
-				return (true);
+
+				++this->_size;
+				return (node);
 			}
 
-			void remove(node_pointer node)
+			// Returns the node holding val and true if it was inserted, false if some was already there
+			ft::pair<node_pointer, bool> insertUnique(const value_type& val)
 			{
-				if (node == NULL)
+				node_pointer parent;
+				bool left;
+				node_pointer found = this->searchInsertPosition(KeyOfValue()(val), parent, left);
+
+				if (found != NULL)
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(this->insertAt(parent, left, val), true));
+			}
+
+			// Same but hint is where we think val should go (it's inserted right before hint)
+			ft::pair<node_pointer, bool> insertUnique(node_pointer hint, const value_type& val)
+			{
+				node_pointer parent;
+				bool left;
+				node_pointer found = this->searchHintPosition(hint, KeyOfValue()(val), parent, left);
+
+				if (found != NULL)
+					return (ft::make_pair(found, false));
+				return (ft::make_pair(this->insertAt(parent, left, val), true));
+			}
+
+			// Returns true if value was inserted, false if some was already there
+			bool insert(const value_type& val) { return (this->insertUnique(val).second); }
+
+			/* Insert a range, if the tree is empty and the range can be read twice (forward iterator or better),
+			   check if it's sorted without duplicates first, in which case the tree is built in O(n) */
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last)
+			{ this->insertRange(first, last, ft::iterator_category_of(first)); }
+
+			// Same but the caller promises the range is sorted without duplicates (see ft::sorted_unique)
+			template <class InputIterator>
+			void insertSortedRange(InputIterator first, InputIterator last)
+			{ this->insertSortedRange(first, last, ft::iterator_category_of(first)); }
+
+			/* Same result as insertRange, but for big unsorted ranges: the range is sorted once then the tree is built
+			   in O(n), no rebalancing. The sort runs on worker threads (threads of them, 0 for one per core, see ParallelSort.hpp),
+			   unless FT_NO_PARALLEL_BULK_INSERT is defined before including: then it's on the calling thread only */
+			template <class InputIterator>
+			void bulkLoad(InputIterator first, InputIterator last, size_type threads)
+			{ this->bulkLoad(first, last, threads, ft::iterator_category_of(first)); }
+
+			// Build a balanced and valid tree from the n next values of first, which must be sorted without duplicates
+			// Tree must be empty, no comparison is made
+			template <class ForwardIterator>
+			void buildSorted(ForwardIterator first, size_type n)
+			{
+				if (n == 0)
 					return;
 
-				this->vanishEndNode();
+				// Depth of the deepest level is floor(log2(n)), only this one is RED
+				size_type redDepth = 0;
+				while ((n >> (redDepth + 1)) != 0)
+					++redDepth;
 
-				int originalColor = node->color;
+				this->setRoot(this->buildSortedSubtree(first, n, 0, redDepth, this->_header));
+				this->root()->setColor(BLACK); // In case it's the only node, so also the deepest level
+				this->leftmost() = minimum(this->root());
+				this->rightmost() = maximum(this->root());
+				this->_size = n;
+			}
+
+			/* Takes node out of the tree and rebalances, without destroying it. Returns the node that followed it
+			   Nodes are relinked, never copied, so the successor stays valid through the whole removal */
+			node_pointer unlinkNode(node_pointer node)
+			{
+				node_pointer next = inorderSuccessor(node);
+
+				// Update cached extremes while the links are still there
+				// The smallest node never has a left child and the biggest never has a right one
+				if (node == this->leftmost())
+					this->leftmost() = (node->right != NULL) ? minimum(node->right) : node->getParent();
+				if (node == this->rightmost())
+					this->rightmost() = (node->left != NULL) ? maximum(node->left) : node->getParent();
+
+				// The node really unlinked is the successor when node has 2 childs, every node above it loses one
+				if (node->left != NULL && node->right != NULL)
+					this->shrinkPath(next);
+				else
+					this->shrinkPath(node);
+
+				int originalColor = node->getColor();
 				node_pointer newNode = NULL;
+				node_pointer newNodeParent = NULL; // newNode may be NULL, so keep track of where it is for the fix up
 
-				if (node->left == NULL && node->right == NULL)
+				if (node->left == NULL)
 				{
-					// If node is a leaf, just remove it from the tree
-					this->replaceNode(node, NULL);
+					// Node only has a right child (or none), just make it's child become the new node
+					newNode = node->right;
+					newNodeParent = node->getParent();
+					replaceNode(node, node->right);
 				}
 				else if (node->right == NULL)
 				{
 					// Node only has a left child, just make it's child become the new node
 					newNode = node->left;
+					newNodeParent = node->getParent();
 					replaceNode(node, node->left);
 				}
-				else if (node->left == NULL)
-				{
-					// Node only has a right child, just make it's child become the new node
-					newNode = node->right;
-					replaceNode(node, node->right);
-				}
 				else
 				{
-					// Node has 2 childs, find inorder successor, which will replace the node
-					node_pointer successor = this->inorderSuccessor(node);
-					originalColor = successor->color;
+					// Node has 2 childs, it's inorder successor will replace the node
+					node_pointer successor = next;
+					originalColor = successor->getColor();
 					newNode = successor->right;
-					if (successor->parent != node)
+					if (successor->getParent() == node)
+						newNodeParent = successor;
+					else
 					{
+						newNodeParent = successor->getParent();
 						replaceNode(successor, successor->right);
 						successor->right = node->right;
-						successor->right->parent = successor;
+						successor->right->setParent(successor);
 					}
 
 					replaceNode(node, successor);
 					successor->left = node->left;
-					successor->left->parent = successor;
-					successor->color = node->color;
+					successor->left->setParent(successor);
+					successor->setColor(node->getColor());
+				#ifdef FT_ORDER_STATISTICS
+					successor->count = node->count; // Takes node's place, node's count was already updated
+				#endif
 				}
 
-				this->deleteNode(node);
+				--this->_size;
 				if (originalColor == BLACK)
-					this->fixDeleteViolations(newNode);
-				
-				this->setEndNodeAtTheEnd();
+					this->fixDeleteViolations(newNode, newNodeParent);
+				return (next);
 			}
 
-			void remove(const value_type& val) { this->remove(this->search(val)); }			
+			/********** Split / join helpers, subtrees handled here are detached (root's parent is NULL) **********/
 
-			node_pointer search(const value_type& val) const
+			// Black nodes on any path from node down to a leaf, node included, 0 for NULL
+			static size_type blackHeight(node_pointer node)
 			{
-				if (this->_root == NULL || (this->isEq(val, this->_root->data)))
-					return (this->_root);
+				size_type height = 0;
 
-				node_pointer curr = this->_root;
+				for (; node != NULL; node = node->left)
+				{
+					if (node->getColor() == BLACK)
+						++height;
+				}
+				return (height);
+			}
 
-				while (curr != NULL && !this->isEq(val, curr->data))
+			// Cut a child from it's parent (height is it's black height), a RED root becomes BLACK so it's a valid tree alone
+			static node_pointer detach(node_pointer node, size_type& height)
+			{
+				if (node == NULL)
+					return (NULL);
+				node->setParent(NULL);
+				if (node->getColor() == RED)
 				{
-					if (isInf(val, curr->data))
-						curr = curr->left;
+					node->setColor(BLACK);
+					++height;
+				}
+				return (node);
+			}
+
+			static void link(node_pointer node, node_pointer left, node_pointer right)
+			{
+				node->left = left;
+				node->right = right;
+				if (left != NULL)
+					left->setParent(node);
+				if (right != NULL)
+					right->setParent(node);
+				updateCount(node);
+			}
+
+			/* Join left, mid and right (everything in left goes before mid, everything in right after) in one tree.
+			   Go down the side of the taller tree facing the other one, to the first BLACK node as high (in black height)
+			   as the shorter tree. mid replaces it as a RED node, with it and the shorter tree as childs: black heights
+			   are still right and at worst mid and it's parent are both RED, which is the usual insert fix up.
+			   O(difference of black heights + 1). height is set to the black height of the result */
+			node_pointer joinTrees(node_pointer left, size_type leftHeight, node_pointer mid, node_pointer right, size_type rightHeight, size_type& height)
+			{
+				if (leftHeight == rightHeight)
+				{
+					mid->reset(NULL, BLACK);
+					link(mid, left, right);
+					height = leftHeight + 1;
+					return (mid);
+				}
+
+				const bool leftTaller = (leftHeight > rightHeight);
+				node_pointer top = leftTaller ? left : right;
+				node_pointer shorter = leftTaller ? right : left;
+				size_type curr = leftTaller ? leftHeight : rightHeight;
+				const size_type target = leftTaller ? rightHeight : leftHeight;
+
+				// top's root is BLACK and higher than target, so parent is never NULL
+				node_pointer parent = NULL;
+				node_pointer node = top;
+				while (node != NULL && (node->getColor() == RED || curr > target))
+				{
+					if (node->getColor() == BLACK)
+						--curr;
+					parent = node;
+					node = leftTaller ? node->right : node->left;
+				}
+
+				mid->reset(parent, RED);
+				if (leftTaller)
+				{
+					link(mid, node, shorter);
+					parent->right = mid;
+				}
+				else
+				{
+					link(mid, shorter, node);
+					parent->left = mid;
+				}
+				// Every node above mid has it's subtree grown by the shorter tree and mid
+				for (node_pointer above = parent; above != NULL; above = above->getParent())
+					updateCount(above);
+
+				// The fix up rotates up to the root, which needs the header above it, so top is our root for a moment
+				this->setRoot(top);
+				top->setParent(this->_header);
+				height = (leftTaller ? leftHeight : rightHeight) + (this->fixInsertionViolations(mid) ? 1 : 0);
+
+				node_pointer root = this->root();
+				root->setParent(NULL);
+				this->setRoot(NULL);
+				return (root);
+			}
+
+			/* Cut the subtree of node (of black height height) in the nodes going before key (left) and the others (right).
+			   Going down the search path, what hangs on the left of the path is joined into left, what hangs on the right
+			   into right. Join costs add up to O(log n) since black heights only go up along the way back */
+			void splitSubtree(node_pointer node, size_type height, const key_type& key,
+							  node_pointer& left, size_type& leftHeight, node_pointer& right, size_type& rightHeight)
+			{
+				if (node == NULL)
+				{
+					left = NULL;
+					right = NULL;
+					leftHeight = 0;
+					rightHeight = 0;
+					return;
+				}
+
+				size_type childLeftHeight = height - ((node->getColor() == BLACK) ? 1 : 0);
+				size_type childRightHeight = childLeftHeight;
+				node_pointer childLeft = detach(node->left, childLeftHeight);
+				node_pointer childRight = detach(node->right, childRightHeight);
+				node_pointer cut;
+				size_type cutHeight;
+
+				if (this->compare(keyOf(node), key))
+				{
+					// node and it's left subtree go left, the right subtree is cut too
+					this->splitSubtree(childRight, childRightHeight, key, cut, cutHeight, right, rightHeight);
+					left = this->joinTrees(childLeft, childLeftHeight, node, cut, cutHeight, leftHeight);
+				}
+				else
+				{
+					this->splitSubtree(childLeft, childLeftHeight, key, left, leftHeight, cut, cutHeight);
+					right = this->joinTrees(cut, cutHeight, node, childRight, childRightHeight, rightHeight);
+				}
+			}
+
+			// Take a detached subtree as our whole tree, size is left to the caller
+			void adoptRoot(node_pointer root)
+			{
+				if (root == NULL)
+					return (this->resetHeader());
+				this->setRoot(root);
+				root->setParent(this->_header);
+				this->leftmost() = minimum(root);
+				this->rightmost() = maximum(root);
+			}
+
+			/* Removes [first, last) and returns last. Each removal hands us the next node, so there is no search at all,
+			   and rebalancing is amortized O(1) per removal: O(k + log n) for k nodes.
+			   (with FT_ORDER_STATISTICS each removal also updates the counts up to the root, so O(k log n))
+			   The whole tree is a clear(), O(n) without any rebalancing */
+			node_pointer removeRange(node_pointer first, node_pointer last)
+			{
+				if (first == this->leftmost() && last == this->_header)
+				{
+					this->clear();
+					return (this->_header);
+				}
+				while (first != last)
+					first = this->remove(first);
+				return (last);
+			}
+
+			/* Without subtree counts, the sizes of two trees cut from one of total values: the smaller one is counted,
+			   walking both at once so we stop as soon as it ends, the other one is what's left. O(smaller) */
+			static void shareSize(self_type& a, self_type& b, size_type total)
+			{
+				node_pointer currA = a.leftmost();
+				node_pointer currB = b.leftmost();
+				size_type counted = 0;
+
+				for (; currA != a._header && currB != b._header; ++counted)
+				{
+					currA = inorderSuccessor(currA);
+					currB = inorderSuccessor(currB);
+				}
+				a._size = (currA == a._header) ? counted : total - counted;
+				b._size = total - a._size;
+			}
+
+			/* Move every value not going before key to right (emptied first, it gets our comparator). Nodes are relinked,
+			   not copied, both trees share their node pool from now on. O(log n) to cut, sizes stay exact: with
+			   FT_ORDER_STATISTICS they come with the subtree counts, otherwise the smaller side is counted (see shareSize) */
+			void split(const key_type& key, self_type& right)
+			{
+				if (this == &right)
+					return;
+
+				right.clear();
+				right._comp = this->_comp;
+				if (this->empty())
+					return;
+
+				this->sharePool(right);
+
+				node_pointer root = this->root();
+				node_pointer leftRoot;
+				node_pointer rightRoot;
+				size_type leftHeight;
+				size_type rightHeight;
+
+				root->setParent(NULL);
+				this->setRoot(NULL);
+				this->splitSubtree(root, blackHeight(root), key, leftRoot, leftHeight, rightRoot, rightHeight);
+				this->adoptRoot(leftRoot);
+				right.adoptRoot(rightRoot);
+
+			#ifdef FT_ORDER_STATISTICS
+				this->_size = subtreeSize(leftRoot);
+				right._size = subtreeSize(rightRoot);
+			#else
+				shareSize(*this, right, this->_size);
+			#endif
+			}
+
+			/* Move every value of other to this tree in O(log n), if all of other's keys go after ours or all before.
+			   Otherwise nothing is moved and false is returned. Both trees share their node pool from now on */
+			bool join(self_type& other)
+			{
+				if (other.empty())
+					return (true);
+
+				self_type* low = this;
+				self_type* high = &other;
+				if (!this->empty() && !this->compare(keyOf(this->rightmost()), keyOf(other.leftmost())))
+				{
+					if (!this->compare(keyOf(other.rightmost()), keyOf(this->leftmost())))
+						return (false);
+					low = &other;
+					high = this;
+				}
+
+				this->sharePool(other);
+
+				size_type total = this->_size + other._size;
+				// Smallest value of the high tree goes in the middle
+				node_pointer mid = high->leftmost();
+				high->unlinkNode(mid);
+
+				node_pointer left = low->root();
+				node_pointer right = high->root();
+				size_type leftHeight = blackHeight(left);
+				size_type rightHeight = blackHeight(right);
+				size_type height;
+
+				if (left != NULL)
+					left->setParent(NULL);
+				if (right != NULL)
+					right->setParent(NULL);
+				this->setRoot(NULL);
+				other.resetHeader();
+				other._size = 0;
+
+				this->adoptRoot(this->joinTrees(left, leftHeight, mid, right, rightHeight, height));
+				this->_size = total;
+				return (true);
+			}
+
+			/********** Set algebra, both trees use the same comparator so their nodes can be read in order at once **********/
+
+			/* Walk a and b in order at once (like std::set_union & co), O(n + m). Nodes of keys only in a, in both, or
+			   only in b are written to out if the matching flag is set (a's node for keys in both).
+			   If dups is not NULL, b's nodes of keys in both are written there. Returns the number of nodes written to out */
+			size_type mergeWalk(const self_type& a, const self_type& b, bool onlyA, bool both, bool onlyB,
+								node_pointer* out, node_pointer* dups) const
+			{
+				node_pointer i = a.leftmost();
+				node_pointer j = b.leftmost();
+				size_type n = 0;
+
+				while (i != a._header && j != b._header)
+				{
+					if (this->compare(keyOf(i), keyOf(j)))
+					{
+						if (onlyA)
+							out[n++] = i;
+						i = inorderSuccessor(i);
+					}
+					else if (this->compare(keyOf(j), keyOf(i)))
+					{
+						if (onlyB)
+							out[n++] = j;
+						j = inorderSuccessor(j);
+					}
 					else
-						curr = curr->right;
+					{
+						if (both)
+							out[n++] = i;
+						if (dups != NULL)
+							*dups++ = j;
+						i = inorderSuccessor(i);
+						j = inorderSuccessor(j);
+					}
 				}
+				// One of them is over, what's left of the other has nothing to be compared with
+				for (; onlyA && i != a._header; i = inorderSuccessor(i))
+					out[n++] = i;
+				for (; onlyB && j != b._header; j = inorderSuccessor(j))
+					out[n++] = j;
+				return (n);
+			}
 
-				if (curr == this->_dummyEnd)
-					return (NULL);
+			/* For each node of small, search it's key in big: O(n log m) instead of O(n + m), see searchIsCheaper.
+			   Nodes whose key is in big (or isn't, if !inBig) are written to out, small's one or big's one (takeBig) */
+			static size_type searchWalk(const self_type& small, const self_type& big, bool inBig, bool takeBig, node_pointer* out)
+			{
+				size_type n = 0;
+
+				for (node_pointer node = small.leftmost(); node != small._header; node = inorderSuccessor(node))
+				{
+					node_pointer found = big.search(keyOf(node));
+
+					if ((found != NULL) == inBig)
+						out[n++] = (found != NULL && takeBig) ? found : node;
+				}
+				return (n);
+			}
+
+			// True if looking each of small's keys up in big costs less comparisons than walking both
+			static bool searchIsCheaper(size_type small, size_type big)
+			{
+				size_type depth = 1;
 
-				return (curr); // Either a isEq(ual) node or NULL
+				while ((big >> depth) != 0)
+					++depth;
+				return (small * depth < small + big);
 			}
 
-			const node_pointer getRoot() const { return (this->_root); }
+			// Replace our values by copies of the n nodes of nodes, sorted without duplicates
+			void copySorted(const node_pointer* nodes, size_type n)
+			{
+				this->clear();
+				this->buildSorted(NodeValueIterator(nodes), n);
+			}
 
-			const node_pointer getDummyEnd() const { return (this->_dummyEnd); }
+			/* result gets copies of the values of both trees, ours for keys in both. Every value is copied anyway,
+			   so it's always the linear walk, then the tree is built directly balanced: O(n + m) */
+			void setUnion(const self_type& other, self_type& result) const
+			{
+				std::allocator<node_pointer> arrayAlloc;
+				size_type capacity = this->size() + other.size();
+				node_pointer* nodes = arrayAlloc.allocate(capacity);
 
-			size_t size() const { return (this->recursiveSize(this->_root)); }
+				result.copySorted(nodes, this->mergeWalk(*this, other, true, true, true, nodes, NULL));
+				arrayAlloc.deallocate(nodes, capacity);
+			}
+
+			// result gets copies of our values whose key is in other, small trees are looked up in the big one
+			void setIntersection(const self_type& other, self_type& result) const
+			{
+				std::allocator<node_pointer> arrayAlloc;
+				size_type capacity = (this->size() < other.size()) ? this->size() : other.size();
+				node_pointer* nodes = arrayAlloc.allocate(capacity);
+				size_type n;
+
+				if (searchIsCheaper(this->size(), other.size()))
+					n = searchWalk(*this, other, true, false, nodes);
+				else if (searchIsCheaper(other.size(), this->size()))
+					n = searchWalk(other, *this, true, true, nodes);
+				else
+					n = this->mergeWalk(*this, other, false, true, false, nodes, NULL);
+				result.copySorted(nodes, n);
+				arrayAlloc.deallocate(nodes, capacity);
+			}
 
-			void clear() {
-				this->recursiveClear(this->_root);
-				
-				// Set parent to null in case we refill the tree after clear
-				this->_dummyEnd->parent = NULL;
+			// result gets copies of our values whose key is not in other, if we are small each of ours is looked up
+			void setDifference(const self_type& other, self_type& result) const
+			{
+				std::allocator<node_pointer> arrayAlloc;
+				size_type capacity = this->size();
+				node_pointer* nodes = arrayAlloc.allocate(capacity);
+				size_type n;
 
-				this->_root = NULL;
+				if (searchIsCheaper(this->size(), other.size()))
+					n = searchWalk(*this, other, false, false, nodes);
+				else
+					n = this->mergeWalk(*this, other, true, false, false, nodes, NULL);
+				result.copySorted(nodes, n);
+				arrayAlloc.deallocate(nodes, capacity);
 			}
 
-			node_pointer first() const
+			/* Move the nodes of other whose key is not already here to this tree, the others stay in other.
+			   Nodes are relinked, never copied nor reallocated, both trees share their node pool from now on.
+			   A few nodes are linked one by one where they go, O(m log(n + m)). Otherwise both trees are walked at once
+			   and rebuilt balanced from their nodes, O(n + m) */
+			void merge(self_type& other)
 			{
-				node_pointer curr = this->_root;
+				if (this == &other || other.empty())
+					return;
 
-				while (curr != NULL && curr->left)
-					curr = curr->left;
-				return (curr);
+				this->sharePool(other);
+
+				if (searchIsCheaper(other.size(), this->size()))
+				{
+					node_pointer node = other.leftmost();
+					node_pointer parent;
+					bool left;
+
+					while (node != other._header)
+					{
+						if (this->searchInsertPosition(keyOf(node), parent, left) != NULL)
+						{
+							node = inorderSuccessor(node);
+							continue;
+						}
+						node_pointer next = other.unlinkNode(node);
+						this->linkNode(parent, left, node);
+						node = next;
+					}
+					return;
+				}
+
+				std::allocator<node_pointer> arrayAlloc;
+				size_type total = this->size() + other.size();
+				size_type otherSize = other.size();
+				node_pointer* nodes = arrayAlloc.allocate(total);
+				node_pointer* dups = arrayAlloc.allocate(otherSize);
+
+				// Every node is in one of the arrays, so the old links can be forgotten
+				size_type n = this->mergeWalk(*this, other, true, true, true, nodes, dups);
+				this->resetHeader();
+				this->_size = 0;
+				other.resetHeader();
+				other._size = 0;
+				this->buildSorted(nodes, n);
+				other.buildSorted(dups, total - n);
+
+				arrayAlloc.deallocate(nodes, total);
+				arrayAlloc.deallocate(dups, otherSize);
+			}
+
+			// Unlinks and destroys node, nothing is searched. Returns the node that followed it (the header if it was the biggest)
+			node_pointer remove(node_pointer node)
+			{
+				if (node == NULL || node == this->_header)
+					return (this->_header);
+
+				node_pointer next = this->unlinkNode(node);
+				this->deleteNode(node);
+				return (next);
+			}
+
+			// Returns the number of values removed (0 or 1 since keys are unique)
+			size_type remove(const key_type& key)
+			{
+				node_pointer node = this->search(key);
+
+				if (node == NULL)
+					return (0);
+				this->remove(node);
+				return (1);
+			}
+
+			// Lower bound descent, then key is there only if it doesn't go before the bound
+			node_pointer search(const key_type& key) const
+			{
+				node_pointer bound = this->lowerBound(key);
+
+				if (bound == this->_header || this->compare(key, keyOf(bound)))
+					return (NULL);
+				return (bound);
+			}
+
+			/* Bounds in a single root to leaf descent
+			   Returns the header (end) when there is no such node */
+
+			// First node not going before key (>= key)
+			node_pointer lowerBound(const key_type& key) const
+			{
+				node_pointer curr = this->root();
+				node_pointer result = this->_header;
+
+				while (curr != NULL)
+				{
+					if (!this->compare(keyOf(curr), key))
+					{
+						result = curr; // Candidate, but there may be a smaller one on the left
+						curr = curr->left;
+					}
+					else
+						curr = curr->right;
+				}
+				return (result);
+			}
+
+			// First node going after key (> key)
+			node_pointer upperBound(const key_type& key) const
+			{
+				node_pointer curr = this->root();
+				node_pointer result = this->_header;
+
+				while (curr != NULL)
+				{
+					if (this->compare(key, keyOf(curr)))
+					{
+						result = curr;
+						curr = curr->left;
+					}
+					else
+						curr = curr->right;
+				}
+				return (result);
 			}
 
-			node_pointer last() const
+			// Keys are unique, so the range is either only the lower bound or empty
+			ft::pair<node_pointer, node_pointer> equalRange(const key_type& key) const
 			{
-				node_pointer curr = this->_root;
+				node_pointer lower = this->lowerBound(key);
 
-				while (curr != NULL && curr->right && curr->right != this->_dummyEnd)
-					curr = curr->right;
-				return (curr); 
+				if (lower == this->_header || this->compare(key, keyOf(lower)))
+					return (ft::make_pair(lower, lower));
+				return (ft::make_pair(lower, inorderSuccessor(lower)));
 			}
 
-			iterator begin()
+			/* Order statistics, O(log n) with FT_ORDER_STATISTICS, otherwise it has to walk the tree in order */
+
+			// Node holding the k-th smallest value (from 0), the header (end) if there are not that many
+			node_pointer select(size_type k) const
 			{
-				node_pointer val = this->first();
+				if (k >= this->size())
+					return (this->_header);
+			#ifdef FT_ORDER_STATISTICS
+				node_pointer curr = this->root();
 
-				if (val == NULL)
-					return (this->end());
-				return (iterator(val));
-			}		
+				while (true)
+				{
+					size_type leftSize = subtreeSize(curr->left);
+
+					if (k < leftSize)
+						curr = curr->left;
+					else if (k == leftSize)
+						return (curr);
+					else
+					{
+						k -= leftSize + 1;
+						curr = curr->right;
+					}
+				}
+			#else
+				node_pointer curr = this->leftmost();
+
+				while (k-- > 0)
+					curr = inorderSuccessor(curr);
+				return (curr);
+			#endif
+			}
+
+			// Number of values going before key
+			size_type rank(const key_type& key) const
+			{
+			#ifdef FT_ORDER_STATISTICS
+				node_pointer curr = this->root();
+				size_type ret = 0;
+
+				while (curr != NULL)
+				{
+					if (this->compare(keyOf(curr), key))
+					{
+						// curr and it's whole left subtree go before key
+						ret += subtreeSize(curr->left) + 1;
+						curr = curr->right;
+					}
+					else
+						curr = curr->left;
+				}
+				return (ret);
+			#else
+				return (this->indexOf(this->lowerBound(key)));
+			#endif
+			}
 
-			const_iterator begin() const
+			// Position of node in order (from 0), size() for the header
+			size_type indexOf(node_pointer node) const
 			{
-				node_pointer val = this->first();
+				if (node == this->_header)
+					return (this->size());
+			#ifdef FT_ORDER_STATISTICS
+				size_type ret = subtreeSize(node->left);
 
-				if (val == NULL)
-					return (this->end());
-				return (const_iterator(val));
+				// Going up from a right child, the parent and it's left subtree were before us
+				for (; node->getParent() != this->_header; node = node->getParent())
+				{
+					if (node == node->getParent()->right)
+						ret += subtreeSize(node->getParent()->left) + 1;
+				}
+				return (ret);
+			#else
+				size_type ret = 0;
+
+				for (node_pointer curr = this->leftmost(); curr != node; curr = inorderSuccessor(curr))
+					++ret;
+				return (ret);
+			#endif
 			}
 
-			iterator		end() {return (iterator(this->_dummyEnd)); }
-			const_iterator	end() const { return (const_iterator(this->_dummyEnd)); }
+			node_pointer getRoot() const { return (this->root()); }
+
+			node_pointer getHeader() const { return (this->_header); }
+
+			size_t size() const { return (this->_size); }
+
+			bool empty() const { return (this->root() == NULL); }
+
+			// Unless asked to keep them, pool memory goes back to the allocator slab by slab instead of node by node
+			void clear() { this->destroyNodes(!this->_keepNodes); }
+
+			// Keep (or not) the pool memory on clear(), worth it when the tree is refilled right after
+			void keepNodesOnClear(bool keep) { this->_keepNodes = keep; }
+
+			// Shared pools (after split / join) count the nodes of every tree using them
+			pool_stats poolStats() const
+			{
+				if (this->_pool == NULL)
+					return (node_pool_type().getStats());
+				return (shared_pool_type::resolved(this->_pool)->pool().getStats());
+			}
+
+			// Smallest / biggest node, NULL if the tree is empty
+			node_pointer first() const { return (this->empty() ? NULL : this->leftmost()); }
+			node_pointer last() const { return (this->empty() ? NULL : this->rightmost()); }
+
+			// Header left is itself when the tree is empty, so begin() == end()
+			iterator		begin() { return (iterator(this->leftmost())); }
+			const_iterator	begin() const { return (const_iterator(this->leftmost())); }
+
+			iterator		end() {return (iterator(this->_header)); }
+			const_iterator	end() const { return (const_iterator(this->_header)); }
 
 			reverse_iterator		rbegin() { return (reverse_iterator(this->end())); }
 			const_reverse_iterator	rbegin() const { return (const_reverse_iterator(this->end())); }
@@ -668,43 +1764,56 @@ namespace ft
 
 			self_type& operator=(const self_type& tree)
 			{
-				this->clear();
+				if (this == &tree)
+					return (*this);
+
+				// Don't release the pool, so the copy reuses the memory of the nodes we just destroyed
+				this->destroyNodes(false);
 				this->_alloc = tree._alloc;
 				this->_nodeAlloc = tree._nodeAlloc;
 				this->_comp = tree._comp;
 
-				this->_root = NULL;
-				this->createEndNode();
-	
-				for (const_iterator it = tree.begin(); it != tree.end(); ++it)
-					this->insert(*it);
+				this->copyFrom(tree);
 
-				this->setEndNodeAtTheEnd();
-				
 				return (*this);
 			}
 
 			void swap(self_type& x)
 			{
-				node_pointer tmp_root = this->_root;
-				node_pointer tmp_dummyEnd = this->_dummyEnd;
+				node_pointer tmp_header = this->_header;
+				size_type tmp_size = this->_size;
 				node_allocator_type tmp_nodeAlloc = this->_nodeAlloc;
+				bool tmp_keepNodes = this->_keepNodes;
 				allocator_type tmp_alloc = this->_alloc;
-				data_compare tmp_comp = this->_comp;
+				key_compare tmp_comp = this->_comp;
 
-				this->_root = x._root;
-				this->_dummyEnd = x._dummyEnd;
+				this->_header = x._header;
+				this->_size = x._size;
 				this->_nodeAlloc = x._nodeAlloc;
+				this->_keepNodes = x._keepNodes;
 				this->_alloc = x._alloc;
 				this->_comp = x._comp;
 
-				x._root = tmp_root;
-				x._dummyEnd = tmp_dummyEnd;
+				x._header = tmp_header;
+				x._size = tmp_size;
 				x._nodeAlloc = tmp_nodeAlloc;
+				x._keepNodes = tmp_keepNodes;
 				x._alloc = tmp_alloc;
 				x._comp = tmp_comp;
+
+				// Nodes belong to the pool that allocated them, so pools follow their nodes
+				shared_pool_type* tmp_pool = this->_pool;
+				this->_pool = x._pool;
+				x._pool = tmp_pool;
 			}
 
+			key_compare key_comp() const { return (this->_comp); }
+
+			// Comparator calls made so far, always 0 unless FT_COUNT_COMPARISONS is defined
+			size_type comparisons() const { return (this->_compCount); }
+
+			void resetComparisons() { this->_compCount = 0; }
+
 			size_type max_size() const { return (this->_nodeAlloc.max_size()); }
 
 	};
@@ -0,0 +1,307 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 17:05 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SORTEDVECTOR_HPP
+# define SORTEDVECTOR_HPP
+
+#include "vector.hpp"
+#include "pairs.hpp"
+#include "iterators.hpp"
+#include "MergeSort.hpp"
+
+#include <memory>
+#include <functional>
+
+namespace ft
+{
+	/* Values with UNIQUE keys kept sorted in a ft::vector, same Key / KeyOfValue / Compare idea as RedBlackTree.
+	   Lookups are binary searches over contiguous memory, inserting / erasing one value shifts everything after it,
+	   so it's made for tables built once (or in bulks) and then mostly read.
+	   Positions are given as indexes, containers turn them into their own iterators */
+	template <class Key, class T, class KeyOfValue, class Compare = std::less<Key>, class Allocator = std::allocator<T> >
+	class SortedVector
+	{
+		private:
+			typedef SortedVector<Key, T, KeyOfValue, Compare, Allocator> self_type;
+
+		public:
+			typedef Key						key_type;
+			typedef T						value_type;
+			typedef Allocator				allocator_type;
+			typedef Compare					key_compare;
+
+			typedef ft::vector<value_type, allocator_type>	vector_type;
+
+			typedef typename vector_type::iterator			iterator;
+			typedef typename vector_type::const_iterator	const_iterator;
+
+			typedef size_t		size_type;
+
+		private:
+			vector_type	_data;
+			key_compare	_comp;
+
+			static const key_type& keyOf(const value_type& val) { return (KeyOfValue()(val)); }
+
+			typedef PositionCompare<KeyOfValue, key_compare> position_compare;
+
+			/* Values are only ever copy constructed by vector (never assigned), but sorting needs to move things around,
+			   so bulk inserts sort positions of the new values instead (iterators of the range, or of a copy of it).
+			   Stable (see MergeSort.hpp), so that out of equal keys the first one of the range stays first
+			   (std::map::insert keeps that one) */
+			template <class Iterator>
+			void sortOrder(ft::vector<Iterator>& order) const
+			{
+				ft::vector<Iterator> buffer(order.size());
+
+				MergeSort<Iterator, position_compare>::sort(&order[0], &buffer[0], order.size(), position_compare(this->_comp));
+			}
+
+			// True if keys go strictly up, in which case there is nothing to sort nor to drop
+			template <class ForwardIterator>
+			bool isSortedUnique(ForwardIterator first, ForwardIterator last) const
+			{
+				size_type n;
+
+				return (ft::isSortedUnique(first, last, position_compare(this->_comp), n));
+			}
+
+			/* Merge the values order points to (sorted) with ours in a new vector, in a single pass.
+			   Keys already there win over new ones, and out of equal new ones the first wins */
+			template <class Iterator>
+			void mergeOrder(const ft::vector<Iterator>& order)
+			{
+				vector_type merged(this->_data.get_allocator());
+				size_type i = 0;
+				size_type j = 0;
+
+				merged.reserve(this->_data.size() + order.size());
+				while (j < order.size())
+				{
+					// Same key as the new value taken right before
+					if (j > 0 && !this->_comp(KeyOfValue()(*order[j - 1]), KeyOfValue()(*order[j])))
+					{
+						++j;
+						continue;
+					}
+					if (i < this->_data.size() && this->_comp(keyOf(this->_data[i]), KeyOfValue()(*order[j])))
+						merged.push_back(this->_data[i++]);
+					else
+					{
+						if (i == this->_data.size() || this->_comp(KeyOfValue()(*order[j]), keyOf(this->_data[i])))
+							merged.push_back(*order[j]);
+						++j;
+					}
+				}
+				for (; i < this->_data.size(); ++i)
+					merged.push_back(this->_data[i]);
+				this->_data.swap(merged);
+			}
+
+			// Values of the range are read where they are, only their positions are sorted (if they are not in order)
+			template <class ForwardIterator>
+			void mergeRange(ForwardIterator first, ForwardIterator last, bool inOrder)
+			{
+				ft::vector<ForwardIterator> order;
+
+				order.reserve(ft::distance(first, last));
+				for (; first != last; ++first)
+					order.push_back(first);
+				if (!inOrder)
+					this->sortOrder(order);
+				this->mergeOrder(order);
+			}
+
+			// Single pass iterators can't be read twice, so values have to be copied somewhere first
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last, bool sorted, ft::input_iterator_tag)
+			{
+				vector_type incoming(this->_data.get_allocator());
+
+				for (; first != last; ++first)
+					incoming.push_back(*first);
+
+				bool inOrder = sorted || this->isSortedUnique(incoming.begin(), incoming.end());
+				// Nothing to merge with nor to drop, take the values as they are
+				if (inOrder && this->_data.empty())
+					return (this->_data.swap(incoming));
+				this->mergeRange(incoming.begin(), incoming.end(), inOrder);
+			}
+
+			// The range can be read twice, no copy: sorted ranges are assigned directly when we are empty
+			template <class ForwardIterator>
+			void insertRange(ForwardIterator first, ForwardIterator last, bool sorted, ft::forward_iterator_tag)
+			{
+				if (first == last)
+					return;
+
+				bool inOrder = sorted || this->isSortedUnique(first, last);
+				if (inOrder && this->_data.empty())
+					return (this->_data.assign(first, last));
+				this->mergeRange(first, last, inOrder);
+			}
+
+		public:
+			SortedVector(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _data(alloc), _comp(comp) { }
+
+			SortedVector(const self_type& x) : _data(x._data.get_allocator()), _comp(x._comp)
+			{ this->_data.assign(x._data.begin(), x._data.end()); }
+
+			self_type& operator=(const self_type& x)
+			{
+				if (this == &x)
+					return (*this);
+
+				this->_data.assign(x._data.begin(), x._data.end());
+				this->_comp = x._comp;
+				return (*this);
+			}
+
+			iterator		begin() { return (this->_data.begin()); }
+			const_iterator	begin() const { return (this->_data.begin()); }
+
+			iterator		end() { return (this->_data.end()); }
+			const_iterator	end() const { return (this->_data.end()); }
+
+			value_type&			at(size_type idx) { return (this->_data[idx]); }
+			const value_type&	at(size_type idx) const { return (this->_data[idx]); }
+
+			size_type size() const { return (this->_data.size()); }
+			bool empty() const { return (this->_data.empty()); }
+			size_type max_size() const { return (this->_data.max_size()); }
+			size_type capacity() const { return (this->_data.capacity()); }
+
+			void reserve(size_type n) { this->_data.reserve(n); }
+
+			key_compare key_comp() const { return (this->_comp); }
+
+			/********** Lookup, all binary searches **********/
+
+			// Index of the first value not going before key, size() if none
+			size_type lowerBound(const key_type& key) const
+			{
+				size_type lo = 0;
+				size_type hi = this->_data.size();
+
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(keyOf(this->_data[mid]), key))
+						lo = mid + 1;
+					else
+						hi = mid;
+				}
+				return (lo);
+			}
+
+			// Index of the first value going after key, size() if none
+			size_type upperBound(const key_type& key) const
+			{
+				size_type lo = 0;
+				size_type hi = this->_data.size();
+
+				while (lo < hi)
+				{
+					size_type mid = lo + (hi - lo) / 2;
+					if (this->_comp(key, keyOf(this->_data[mid])))
+						hi = mid;
+					else
+						lo = mid + 1;
+				}
+				return (lo);
+			}
+
+			// Index of the value with key, size() if not there
+			size_type search(const key_type& key) const
+			{
+				size_type idx = this->lowerBound(key);
+
+				if (idx == this->_data.size() || this->_comp(key, keyOf(this->_data[idx])))
+					return (this->_data.size());
+				return (idx);
+			}
+
+			/********** Modifiers **********/
+
+			// Index of the value with val's key, and true if val was inserted, false if some was already there
+			ft::pair<size_type, bool> insertUnique(const value_type& val)
+			{
+				size_type idx = this->lowerBound(keyOf(val));
+
+				if (idx < this->_data.size() && !this->_comp(keyOf(val), keyOf(this->_data[idx])))
+					return (ft::make_pair(idx, false));
+				return (ft::make_pair(this->insertAt(idx, val), true));
+			}
+
+			/* Same but hint is where we think val goes (right before the value at hint). If the values around it agree
+			   there is no search at all, so inserting sorted values at the end is amortized O(1).
+			   Otherwise it's the usual binary search */
+			ft::pair<size_type, bool> insertUnique(size_type hint, const value_type& val)
+			{
+				const key_type& key = keyOf(val);
+
+				if ((hint == 0 || this->_comp(keyOf(this->_data[hint - 1]), key))
+					&& (hint == this->_data.size() || this->_comp(key, keyOf(this->_data[hint]))))
+					return (ft::make_pair(this->insertAt(hint, val), true));
+				return (this->insertUnique(val));
+			}
+
+			// Insert val at idx without checking anything (eg. where lowerBound said), returns idx
+			size_type insertAt(size_type idx, const value_type& val)
+			{
+				this->_data.insert(this->_data.begin() + idx, val);
+				return (idx);
+			}
+
+			/* Bulk insert, sort the new values once (stable, first of equal keys wins) then merge them with ours,
+			   O(n + k log k) instead of shifting everything for each of the k values */
+			template <class InputIterator>
+			void insertRange(InputIterator first, InputIterator last)
+			{ this->insertRange(first, last, false, ft::iterator_category_of(first)); }
+
+			// Same but the caller promises the range is sorted without duplicates (see ft::sorted_unique), only merge
+			template <class InputIterator>
+			void insertSortedRange(InputIterator first, InputIterator last)
+			{ this->insertRange(first, last, true, ft::iterator_category_of(first)); }
+
+			void removeAt(size_type idx) { this->_data.erase(this->_data.begin() + idx); }
+
+			void removeRange(size_type first, size_type last)
+			{ this->_data.erase(this->_data.begin() + first, this->_data.begin() + last); }
+
+			// Returns the number of values removed (0 or 1 since keys are unique)
+			size_type remove(const key_type& key)
+			{
+				size_type idx = this->search(key);
+
+				if (idx == this->_data.size())
+					return (0);
+				this->removeAt(idx);
+				return (1);
+			}
+
+			void clear() { this->_data.clear(); }
+
+			void swap(self_type& x)
+			{
+				key_compare tmp_comp = this->_comp;
+
+				this->_comp = x._comp;
+				x._comp = tmp_comp;
+				this->_data.swap(x._data);
+			}
+	};
+
+}
+
+#endif
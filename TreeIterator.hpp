@@ -45,6 +45,9 @@ namespace ft
 			// Allow conversion from non-const to const, but not the other way around
 			operator TreeIterator<Tree, true>() { return (TreeIterator<Tree, true>(this->_node)); }
 
+			// Node pointed to, so that containers can give it back to the tree (eg. insert hint) without searching for it
+			typename Tree::node_pointer getNode() const { return (this->_node); }
+
 			/********** Relational operators **********/
 
 			// *A
@@ -56,7 +59,7 @@ namespace ft
 			// ++A
 			TreeIterator<Tree, IsConst>& operator++()
 			{
-				if (this->_node->color == END_NODE_COLOR)
+				if (this->_node->getColor() == END_NODE_COLOR)
 					return (*this);
 				this->_node = Tree::inorderSuccessor(this->_node);
 				return (*this);
@@ -0,0 +1,217 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 15:40 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_SET_HPP
+# define BTREE_SET_HPP
+
+#include "pairs.hpp"
+#include "comparisons.hpp"
+#include "BPlusTree.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace ft
+{
+	/* Same interface as ft::set, but stored in a B+ tree (see BPlusTree.hpp), so it can replace it with a typedef.
+	   Lookups and iteration touch a lot less memory, the catch is that insert / erase invalidate iterators */
+	template <class T,
+			  class Compare = std::less<T>,
+			  class Alloc = std::allocator<T>
+			 >
+	class btree_set
+	{
+		public:
+			typedef T key_type;
+			typedef T value_type;
+
+			typedef Compare	key_compare;
+			typedef Compare	value_compare;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef BPlusTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type> tree_type;
+
+		public:
+			// Values are const in a set, so both are the const_iterator
+			typedef typename tree_type::const_iterator	iterator;
+			typedef typename tree_type::const_iterator	const_iterator;
+
+			typedef typename tree_type::const_reverse_iterator	reverse_iterator;
+			typedef typename tree_type::const_reverse_iterator	const_reverse_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+		private:
+			allocator_type	_alloc; // Comparator lives in the tree
+			tree_type		_tree;
+
+		public:
+			// Default constructor / empty
+			explicit btree_set(const key_compare& comp = key_compare(),
+							   const allocator_type& alloc = allocator_type())
+							   : _alloc(alloc), _tree(comp, alloc) { }
+
+			// Range constructor, sorted ranges are built in O(n)
+			template <class InputIterator>
+			btree_set(InputIterator first, InputIterator last,
+					  const key_compare& comp = key_compare(),
+					  const allocator_type& alloc = allocator_type())
+					  : _alloc(alloc), _tree(comp, alloc)
+			{ this->_tree.insertRange(first, last); }
+
+			// Same but the range is known to be sorted without duplicates, so it's not checked
+			template <class InputIterator>
+			btree_set(ft::sorted_unique_t, InputIterator first, InputIterator last,
+					  const key_compare& comp = key_compare(),
+					  const allocator_type& alloc = allocator_type())
+					  : _alloc(alloc), _tree(comp, alloc)
+			{ this->_tree.insertSortedRange(first, last); }
+
+			// Copy constructor, deep copy tree
+			btree_set(const btree_set& x) : _alloc(x._alloc), _tree(x._tree) { }
+
+			// Assignation operator
+			btree_set& operator=(const btree_set& x)
+			{
+				this->_alloc = x._alloc;
+				this->_tree = x._tree;
+
+				return (*this);
+			}
+
+			/********** Iterators **********/
+			iterator	begin() const { return (this->_tree.begin()); }
+			iterator	end() const { return (this->_tree.end()); }
+
+			reverse_iterator	rbegin() const { return (reverse_iterator(this->end())); }
+			reverse_iterator	rend() const { return (reverse_iterator(this->begin())); }
+
+			/********** Capacity **********/
+			bool empty() const { return (this->_tree.empty()); }
+			size_type size() const { return (this->_tree.size()); }
+			size_type max_size() const { return (this->_tree.max_size()); }
+
+			/********** Modifiers **********/
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<typename tree_type::iterator, bool> ret = this->_tree.insertUnique(val);
+				return (ft::make_pair(iterator(ret.first), ret.second));
+			}
+
+			// If val goes right before position in the same leaf (or at an end), it goes there without descending
+			iterator insert(iterator position, const value_type& val)
+			{ return (this->_tree.insertUnique(position, val).first); }
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{ this->_tree.insertRange(first, last); }
+
+			template <class InputIterator>
+			void insert(ft::sorted_unique_t, InputIterator first, InputIterator last)
+			{ this->_tree.insertSortedRange(first, last); }
+
+			size_type erase(const key_type& k) { return (this->_tree.remove(k)); }
+
+			// Return the element that followed the erased one(s)
+			iterator erase(iterator position) { return (this->_tree.remove(position)); }
+
+			iterator erase(iterator first, iterator last) { return (this->_tree.removeRange(first, last)); }
+
+			void swap(btree_set& x)
+			{
+				allocator_type tmp_alloc = this->_alloc;
+
+				this->_alloc = x._alloc;
+				x._alloc = tmp_alloc;
+
+				this->_tree.swap(x._tree); // Swaps comparators too
+			}
+
+			void clear() { this->_tree.clear(); }
+
+			/********** Observers **********/
+			key_compare key_comp() const { return (this->_tree.key_comp()); }
+
+			value_compare value_comp() const { return (this->_tree.key_comp()); }
+
+			/********** Lookup / Operations **********/
+			iterator find(const key_type& k) const { return (this->_tree.search(k)); }
+
+			size_type count(const key_type& k) const
+			{
+				if (this->_tree.search(k) != this->_tree.end())
+					return (1);
+				return (0);
+			}
+
+			iterator lower_bound(const key_type& k) const { return (this->_tree.lowerBound(k)); }
+
+			iterator upper_bound(const key_type& k) const { return (this->_tree.upperBound(k)); }
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) const
+			{
+				ft::pair<typename tree_type::iterator, typename tree_type::iterator> range = this->_tree.equalRange(k);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
+			}
+
+			/********** Allocator **********/
+			allocator_type get_allocator() const { return (this->_alloc); }
+
+			/********** B+ tree (not in std) **********/
+			// Levels from the root to the leaves, 1 when everything fits in a single leaf
+			size_type height() const { return (this->_tree.height()); }
+	};
+
+	/********** Non-member overloads **********/
+	template <class T, class Compare, class Alloc>
+	void swap(ft::btree_set<T, Compare, Alloc>& x, ft::btree_set<T, Compare, Alloc>& y)
+	{ x.swap(y); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator==(const ft::btree_set<T, Compare, Alloc>& lhs,
+					const ft::btree_set<T, Compare, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Compare, class Alloc>
+	bool operator!=(const ft::btree_set<T, Compare, Alloc>& lhs,
+					const ft::btree_set<T, Compare, Alloc>& rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator<(const ft::btree_set<T, Compare, Alloc>& lhs, const ft::btree_set<T, Compare, Alloc>& rhs)
+	{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator<=(const ft::btree_set<T, Compare, Alloc>& lhs, const ft::btree_set<T, Compare, Alloc>& rhs)
+	{ return (!(rhs < lhs)); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator>(const ft::btree_set<T, Compare, Alloc>& lhs, const ft::btree_set<T, Compare, Alloc>& rhs)
+	{ return (rhs < lhs); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator>=(const ft::btree_set<T, Compare, Alloc>& lhs, const ft::btree_set<T, Compare, Alloc>& rhs)
+	{ return (!(lhs < rhs)); }
+}
+
+#endif
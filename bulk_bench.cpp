@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 19:40 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Building a ft::map from main.cpp's million random pairs: range insert vs bulk_insert with 1, 2, 4... worker threads
+   c++ -Wall -Wextra -Werror -std=c++98 -O2 -pthread bulk_bench.cpp -o bulk_bench && ./bulk_bench [count] [seed] */
+
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+
+#include "map.hpp"
+#include "vector.hpp"
+
+// Wall clock, clock() would add up the time of every thread
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0);
+}
+
+int main(int argc, char** argv)
+{
+	size_t count = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int seed = (argc > 2) ? atoi(argv[2]) : 42;
+	ft::vector<ft::pair<int, int> > values;
+	double start;
+
+	srand(seed);
+	for (size_t i = 0; i < count; ++i)
+		values.push_back(ft::make_pair(rand(), rand()));
+
+	start = now();
+	ft::map<int, int> inserted(values.begin(), values.end());
+	std::cout << "insert:              " << now() - start << " ms (" << inserted.size() << " keys)" << std::endl;
+
+	size_t cores = ft::ParallelSort<int, std::less<int> >::hardwareThreads();
+	for (size_t threads = 1; threads <= 2 * cores; threads *= 2)
+	{
+		ft::map<int, int> loaded;
+
+		start = now();
+		loaded.bulk_insert(values.begin(), values.end(), threads);
+		std::cout << "bulk_insert, " << threads << " threads: " << now() - start << " ms"
+				  << ((loaded == inserted) ? "" : " (WRONG)") << std::endl;
+	}
+	std::cout << "(" << cores << " cores)" << std::endl;
+	return (0);
+}
@@ -0,0 +1,52 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+typedef TESTED_NAMESPACE::btree_map<T1, T2> ft_mp;
+
+template <typename MAP>
+void	ft_bound(MAP &mp, const T1 &param)
+{
+	typename MAP::iterator ite = mp.end(), it[2];
+	_pair<typename MAP::iterator, typename MAP::iterator> ft_range;
+
+	it[0] = mp.lower_bound(param); it[1] = mp.upper_bound(param);
+	ft_range = mp.equal_range(param);
+	std::cout << "with key [" << param << "]:" << std::endl;
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+	std::cout << "find: " << (mp.find(param) == ite ? "end()" : printPair(mp.find(param), false))
+			  << " | count: " << mp.count(param) << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	ft_bound(mp, 1);
+	for (int i = 0; i < 2000; ++i)
+		mp[i * 5] = i;
+
+	// First / last key of the map, keys between leaves, out of range both ways
+	ft_bound(mp, 0);
+	ft_bound(mp, 9995);
+	ft_bound(mp, 3);
+	ft_bound(mp, 5000);
+	ft_bound(mp, 5001);
+	ft_bound(mp, -10);
+	ft_bound(mp, 10000);
+
+	int errors = 0;
+	for (int k = -3; k < 10005; ++k)
+	{
+		ft_mp::const_iterator lower = static_cast<const ft_mp &>(mp).lower_bound(k);
+		int expected = (k <= 0) ? 0 : (k + 4) / 5 * 5;
+		if ((expected >= 10000) ? lower != mp.end() : lower->first != expected)
+			++errors;
+	}
+	std::cout << "errors: " << errors << std::endl;
+
+	return (0);
+}
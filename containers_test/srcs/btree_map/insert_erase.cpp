@@ -0,0 +1,98 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::btree_map<T1, T2> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+static void	printSome(ft_mp &mp)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (mp.empty())
+		return;
+	std::cout << "first: " << printPair(mp.begin(), false) << " | last: " << printPair(--mp.end(), false) << std::endl;
+	long sum = 0;
+	for (ft_mp::iterator it = mp.begin(); it != mp.end(); ++it)
+		sum += it->first;
+	long rsum = 0;
+	for (ft_mp::reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+		rsum += it->first;
+	std::cout << "sum: " << sum << " | reverse sum: " << rsum << std::endl;
+}
+
+// C++98 std::map::erase returns nothing, std gives what ft should return: the element after the erased one
+#if !defined(USING_STD)
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator pos) { return (mp.erase(pos)); }
+#else
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator pos) { mp.erase(pos++); return (pos); }
+#endif
+
+int		main(void)
+{
+	ft_mp mp;
+
+	// Many leaves, split in every direction
+	for (int i = 0; i < 5000; ++i)
+		mp[(i * 7919) % 5000] = "x";
+	printSome(mp);
+
+	// operator[] on present and missing keys, insert of a present key
+	mp[42] = "forty two";
+	std::cout << "mp[42]: " << mp[42] << " | mp[-1]: [" << mp[-1] << "]" << std::endl;
+	_pair<ft_mp::iterator, bool> ret = mp.insert(T3(42, "again"));
+	std::cout << "inserted: " << ret.second << " | " << printPair(ret.first, false) << std::endl;
+
+	// Hints: at the end for sorted input, good and bad ones in the middle
+	ft_mp hinted;
+	for (int i = 0; i < 3000; ++i)
+		hinted.insert(hinted.end(), T3(i, "end"));
+	hinted.insert(hinted.find(100), T3(100, "present"));
+	hinted.insert(hinted.begin(), T3(5000, "bad hint"));
+	hinted.insert(hinted.end(), T3(-5, "bad hint"));
+	hinted.erase(1500);
+	std::cout << printPair(hinted.insert(hinted.find(1501), T3(1500, "good hint")), false) << std::endl;
+	printSome(hinted);
+
+	// Erase by position, going on from the element returned: leaves shrink, borrow and merge on the way
+	int kept = 0;
+	for (ft_mp::iterator it = hinted.begin(); it != hinted.end(); )
+	{
+		if (it->first % 3 != 0)
+			it = eraseNext(hinted, it);
+		else
+		{
+			++kept;
+			++it;
+		}
+	}
+	std::cout << "kept: " << kept << std::endl;
+	printSome(hinted);
+
+	// Erase by key, by position, and ranges inside a leaf, across leaves and everything
+	std::cout << "erase(42): " << mp.erase(42) << " | erase(42): " << mp.erase(42) << std::endl;
+	mp.erase(mp.begin());
+	mp.erase(--mp.end());
+	printSome(mp);
+	mp.erase(mp.find(10), mp.find(13));
+	mp.erase(mp.find(100), mp.find(4000));
+	printSome(mp);
+	for (int i = 0; i < 5000; i += 2)
+		mp.erase(i);
+	printSome(mp);
+	printSize(mp);
+	mp.erase(mp.begin(), mp.end());
+	printSome(mp);
+
+	// Refilled after that
+	for (int i = 0; i < 100; ++i)
+		mp[i] = "again";
+	printSome(mp);
+
+	ft_mp copy(mp);
+	mp.clear();
+	std::cout << "copy == hinted: " << (copy == hinted) << " | copy < hinted: " << (copy < hinted) << std::endl;
+	printSome(copy);
+
+	return (0);
+}
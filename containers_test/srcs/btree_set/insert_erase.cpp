@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+#define T1 std::string
+
+typedef TESTED_NAMESPACE::btree_set<T1> ft_st;
+
+static std::string	key(int i)
+{
+	std::string ret;
+
+	for (; i > 0; i /= 10)
+		ret += static_cast<char>('0' + i % 10);
+	return (ret + "!");
+}
+
+int		main(void)
+{
+	ft_st st;
+
+	for (int i = 0; i < 3000; ++i)
+		st.insert(key((i * 31) % 3000));
+	std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+	std::cout << "insert again: " << st.insert(key(7)).second << " | hinted: " << *st.insert(st.end(), key(3001)) << std::endl;
+
+	st.erase(st.find(key(100)), st.find(key(200)));
+	std::cout << "erase(3001): " << st.erase(key(3001)) << " | erase(100): " << st.erase(key(100)) << std::endl;
+	for (int i = 0; i < 3000; i += 3)
+		st.erase(key(i));
+	std::cout << "size: " << st.size() << std::endl;
+
+	ft_st small;
+	for (int i = 0; i < 20; ++i)
+		small.insert(small.begin(), key(i));
+	printSize(small);
+	printReverse(small);
+
+	ft_st copy(st);
+	copy.erase(copy.begin(), copy.end());
+	std::cout << "copy: " << copy.size() << " | st: " << st.size() << " | empty: " << copy.empty() << std::endl;
+	copy.insert(st.begin(), st.end());
+	std::cout << "equal: " << (copy == st) << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,61 @@
+#include "common.hpp"
+#include <memory>
+
+#define T1 int
+#define T2 std::string
+
+// Counts what each allocator instance (by tag) allocates, so we see which one a container really uses
+static int	allocations[3] = { 0, 0, 0 };
+
+template <class T>
+class tagged_allocator : public std::allocator<T>
+{
+	public:
+		typedef typename std::allocator<T>::pointer		pointer;
+		typedef typename std::allocator<T>::size_type	size_type;
+
+		template <class U>
+		struct rebind { typedef tagged_allocator<U> other; };
+
+		int	tag;
+
+		tagged_allocator(int t = 0) : std::allocator<T>(), tag(t) { }
+		tagged_allocator(const tagged_allocator& x) : std::allocator<T>(x), tag(x.tag) { }
+		template <class U>
+		tagged_allocator(const tagged_allocator<U>& x) : std::allocator<T>(), tag(x.tag) { }
+
+		pointer allocate(size_type n, const void* hint = 0)
+		{
+			++allocations[this->tag];
+			return (std::allocator<T>::allocate(n, hint));
+		}
+};
+
+typedef tagged_allocator<_pair<const T1, T2> > T3_alloc;
+typedef TESTED_NAMESPACE::flat_map<T1, T2, std::less<T1>, T3_alloc> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+int		main(void)
+{
+	ft_mp mp(std::less<T1>(), T3_alloc(1));
+
+	for (int i = 0; i < 50; ++i)
+		mp.insert(T3(i, "value"));
+
+	// A copy allocates with a copy of our allocator, never a default one
+	ft_mp copy(mp);
+	copy.insert(T3(100, "more"));
+	std::cout << "copy tag: " << copy.get_allocator().tag << std::endl;
+	std::cout << "default allocator used: " << (allocations[0] != 0) << std::endl;
+	std::cout << "tagged allocator used: " << (allocations[1] != 0) << std::endl;
+	printSize(copy, false);
+
+	// Assigned and merged into, still no default allocator
+	ft_mp other(std::less<T1>(), T3_alloc(2));
+	other = mp;
+	other.insert(copy.begin(), copy.end());
+	std::cout << "other size: " << other.size() << std::endl;
+	std::cout << "default allocator used: " << (allocations[0] != 0) << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::flat_map<T1, T2> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+int		main(void)
+{
+	ft_mp mp;
+
+#if !defined(USING_STD)
+	mp.reserve(64); // Not in std::map, no visible effect
+#endif
+	// Hinted at end() in order, hinted at the right place, at a wrong one, and on a key we have
+	for (int i = 0; i < 20; i += 2)
+		mp.insert(mp.end(), T3(i, "even"));
+	std::cout << printPair(mp.insert(mp.find(8), T3(7, "good hint")), false) << std::endl;
+	std::cout << printPair(mp.insert(mp.begin(), T3(13, "bad hint")), false) << std::endl;
+	std::cout << printPair(mp.insert(mp.find(4), T3(4, "present")), false) << std::endl;
+	std::cout << printPair(mp.insert(mp.end(), T3(-1, "bad hint")), false) << std::endl;
+	printSize(mp);
+
+	// operator[] searches once, inserts in place if missing
+	mp[5] = "five";
+	std::cout << "mp[5]: " << mp[5] << " | mp[6]: [" << mp[6] << "]" << std::endl;
+	std::cout << "insert(5): " << mp.insert(T3(5, "again")).second << std::endl;
+
+	// Ranges: unsorted with duplicates (first kept, ours kept), sorted
+	std::list<T3> lst;
+	lst.push_back(T3(100, "first hundred"));
+	lst.push_back(T3(50, "fifty"));
+	lst.push_back(T3(100, "second hundred"));
+	lst.push_back(T3(5, "not ours"));
+	mp.insert(lst.begin(), lst.end());
+	printSize(mp);
+
+	std::list<T3> sorted;
+	for (int i = 0; i < 10; ++i)
+		sorted.push_back(T3(i * 3, "sorted"));
+	ft_mp fromSorted(sorted.begin(), sorted.end());
+	printSize(fromSorted);
+	ft_mp fromUnsorted(lst.begin(), lst.end());
+	printSize(fromUnsorted);
+
+	// Erase by key, position, range
+	std::cout << "erase(100): " << mp.erase(100) << " | erase(100): " << mp.erase(100) << std::endl;
+	mp.erase(mp.begin());
+	mp.erase(mp.find(6), mp.find(14));
+	printSize(mp);
+	printReverse(mp);
+	mp.erase(mp.begin(), mp.end());
+	printSize(mp);
+
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+#include <list>
+#include <sstream>
+#include <iterator>
+
+#define T1 int
+
+typedef TESTED_NAMESPACE::flat_set<T1> ft_st;
+
+int		main(void)
+{
+	ft_st st;
+
+	// Sorted inserts hinted at end(), then hints good and bad
+	for (int i = 0; i < 1000; ++i)
+		st.insert(st.end(), i * 2);
+	std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+	std::cout << *st.insert(st.find(500), 499) << " " << *st.insert(st.begin(), 1999) << " " << *st.insert(st.end(), -3)
+			  << " " << *st.insert(st.find(10), 10) << std::endl;
+	std::cout << "size: " << st.size() << std::endl;
+
+	// Single pass range, with duplicates, into a non-empty set
+	std::istringstream input("7 3 7 2001 -3 5 3");
+	std::istream_iterator<int> in(input), end;
+	ft_st small;
+	small.insert(42);
+	small.insert(in, end);
+	printSize(small);
+
+	// Forward range, unsorted, into an empty set and into a full one
+	std::list<int> lst;
+	for (int i = 10; i > 0; --i)
+		lst.push_back(i % 4 + i * 100);
+	lst.push_back(501);
+	ft_st fromList(lst.begin(), lst.end());
+	printSize(fromList);
+	st.insert(lst.begin(), lst.end());
+	std::cout << "size: " << st.size() << " | count(501): " << st.count(501) << std::endl;
+
+	std::cout << "erase(499): " << st.erase(499) << " | erase(499): " << st.erase(499) << std::endl;
+	st.erase(st.find(100), st.find(1900));
+	st.erase(st.begin());
+	std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+
+	ft_st copy(st);
+	st.clear();
+	std::cout << "copy: " << copy.size() << " | st: " << st.size() << " | lower_bound(1900): " << *copy.lower_bound(1900) << std::endl;
+
+	return (0);
+}
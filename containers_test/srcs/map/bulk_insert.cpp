@@ -0,0 +1,60 @@
+#include "common.hpp"
+#include <list>
+#include <vector>
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// Not in std, std gets the same result from a range insert: the first of equal keys, and ours if we have it
+template <typename It>
+void	bulkInsert(ft_mp &mp, It first, It last)
+{
+#if !defined(USING_STD)
+	mp.bulk_insert(first, last, 2);
+#else
+	mp.insert(first, last);
+#endif
+}
+
+int		main(void)
+{
+	std::vector<T3> values;
+	for (int i = 0; i < 20000; ++i)
+		values.push_back(T3((i * 7919) % 5000, (i < 5000) ? "first" : "later"));
+
+	// Every key 4 times, only the first one of each stays
+	ft_mp mp;
+	bulkInsert(mp, values.begin(), values.end());
+	std::cout << "size: " << mp.size() << std::endl;
+	int firsts = 0;
+	for (ft_mp::iterator it = mp.begin(); it != mp.end(); ++it)
+		firsts += (it->second == "first");
+	std::cout << "kept the first: " << firsts << std::endl;
+
+	std::list<T3> lst;
+	lst.push_back(T3(3, "three"));
+	lst.push_back(T3(1, "one"));
+	lst.push_back(T3(3, "three again"));
+	lst.push_back(T3(2, "two"));
+	lst.push_back(T3(1, "one again"));
+	ft_mp small;
+	bulkInsert(small, lst.begin(), lst.end());
+	printSize(small);
+
+	// Into a map that has some of the keys already: ours win
+	small[2] = "ours";
+	lst.push_back(T3(10, "ten"));
+	bulkInsert(small, lst.begin(), lst.end());
+	printSize(small);
+
+	// Empty range, and the map still works after
+	bulkInsert(small, lst.end(), lst.end());
+	small.erase(1);
+	small[0] = "zero";
+	printSize(small);
+	printReverse(small);
+
+	return (0);
+}
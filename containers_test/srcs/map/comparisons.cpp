@@ -0,0 +1,83 @@
+#define FT_COUNT_COMPARISONS
+#include "common.hpp"
+#include <cctype>
+
+#define T1 std::string
+#define T2 int
+
+static unsigned long calls = 0;
+
+// Case insensitive, so equal keys are not always the same string
+struct ft_nocase {
+	bool	operator()(const T1 &first, const T1 &second) const {
+		++calls;
+		for (size_t i = 0; i < first.size() && i < second.size(); ++i)
+		{
+			char a = std::tolower(first[i]);
+			char b = std::tolower(second[i]);
+			if (a != b)
+				return (a < b);
+		}
+		return (first.size() < second.size());
+	}
+};
+
+typedef TESTED_NAMESPACE::map<T1, T2, ft_nocase> ft_mp;
+
+static std::string	key(int i)
+{
+	std::string ret;
+
+	for (int j = 0; j < 4; ++j, i /= 7)
+		ret += static_cast<char>(((j % 2) ? 'a' : 'A') + i % 7);
+	return (ret);
+}
+
+// Comparisons counted by the map are the comparator calls (comparisons() is not in std, std prints what ft should)
+static void	checkCount(ft_mp &mp, unsigned long before, unsigned long bound)
+{
+#if !defined(USING_STD)
+	std::cout << "counted: " << (mp.comparisons() == calls - before) << " | within " << bound << ": " << (calls - before <= bound) << std::endl;
+	mp.reset_comparisons();
+#else
+	(void)mp; (void)before;
+	std::cout << "counted: " << 1 << " | within " << bound << ": " << 1 << std::endl;
+#endif
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 2000; ++i)
+		mp[key(i)] = i;
+	std::cout << "size: " << mp.size() << std::endl;
+#if !defined(USING_STD)
+	mp.reset_comparisons();
+#endif
+
+	// Found whatever the case, one comparison per level plus one at the end (depth <= 2 * log2(n + 1))
+	unsigned long before = calls;
+	ft_mp::iterator it = mp.find("aaaa");
+	std::cout << "find(aaaa): " << printPair(it, false) << std::endl;
+	checkCount(mp, before, 24);
+
+	before = calls;
+	std::cout << "count(GbCd): " << mp.count("gBcD") << std::endl;
+	checkCount(mp, before, 24);
+
+	before = calls;
+	std::cout << "find(zzzz) is end: " << (mp.find("zzzz") == mp.end()) << std::endl;
+	checkCount(mp, before, 24);
+
+	before = calls;
+	mp["bBbB"] = -1;
+	std::cout << "mp[BbBb]: " << mp["BbBb"] << std::endl;
+	checkCount(mp, before, 48);
+
+	before = calls;
+	std::cout << "lower_bound(C): " << printPair(mp.lower_bound("C"), false) << std::endl;
+	checkCount(mp, before, 24);
+
+	return (0);
+}
@@ -0,0 +1,58 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 20; ++i)
+		mp[(i * 13) % 20] = std::string(i % 5 + 1, 'a' + i);
+
+	// Same content, same order, both ways
+	ft_mp copy(mp);
+	printSize(copy);
+	printReverse(copy);
+	std::cout << "equal: " << (copy == mp) << std::endl;
+
+	// Copies don't share anything
+	copy[3] = "changed";
+	copy.erase(7);
+	mp.erase(12);
+	std::cout << "mp[3]: " << mp[3] << " | copy has 12: " << copy.count(12) << " | mp has 7: " << mp.count(7) << std::endl;
+
+	// Assignment over a bigger, a smaller and an empty map, and to itself
+	ft_mp big;
+	for (int i = 0; i < 100; ++i)
+		big[i] = "big";
+	big = mp;
+	printSize(big);
+	ft_mp small;
+	small[1000] = "small";
+	small = big;
+	std::cout << "equal: " << (small == mp) << std::endl;
+	ft_mp empty;
+	small = empty;
+	printSize(small);
+	ft_mp &same = mp;
+	mp = same;
+	printSize(mp);
+
+	// The copy is a normal tree, it still inserts and erases fine
+	ft_mp other(mp);
+	for (int i = 20; i < 60; ++i)
+		other[i] = "more";
+	for (int i = 0; i < 60; i += 3)
+		other.erase(i);
+	printSize(other);
+	printReverse(other);
+
+	const ft_mp constant(other);
+	ft_mp fromConst(constant);
+	std::cout << "equal: " << (fromConst == other) << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,53 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// C++98 std::map::erase returns nothing, std gives what ft should return: the element after the erased one(s)
+#if !defined(USING_STD)
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator pos) { return (mp.erase(pos)); }
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator first, ft_mp::iterator last) { return (mp.erase(first, last)); }
+#else
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator pos) { mp.erase(pos++); return (pos); }
+static ft_mp::iterator	eraseNext(ft_mp &mp, ft_mp::iterator first, ft_mp::iterator last) { mp.erase(first, last); return (last); }
+#endif
+
+static void	printNext(ft_mp &mp, ft_mp::iterator next)
+{
+	std::cout << "next: " << (next == mp.end() ? "end()" : printPair(next, false)) << " | size: " << mp.size() << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 30; ++i)
+		mp[i] = std::string(1, 'a' + i % 26);
+
+	printNext(mp, eraseNext(mp, mp.begin()));
+	printNext(mp, eraseNext(mp, mp.find(10)));
+	printNext(mp, eraseNext(mp, --mp.end()));
+	printNext(mp, eraseNext(mp, mp.find(3), mp.find(7)));
+	printNext(mp, eraseNext(mp, mp.find(20), mp.end()));
+	printNext(mp, eraseNext(mp, mp.find(11), mp.find(11)));
+
+	// Erase while walking, every element with an odd key
+	for (ft_mp::iterator it = mp.begin(); it != mp.end();)
+	{
+		if (it->first % 2)
+			it = eraseNext(mp, it);
+		else
+			++it;
+	}
+	printSize(mp);
+
+	// The iterator returned is a normal one, erasing from it again until empty
+	ft_mp::iterator it = mp.begin();
+	while (it != mp.end())
+		it = eraseNext(mp, it);
+	printNext(mp, it);
+
+	return (0);
+}
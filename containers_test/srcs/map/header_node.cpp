@@ -0,0 +1,57 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+static void	printEnds(ft_mp &mp)
+{
+	if (mp.begin() == mp.end())
+	{
+		std::cout << "empty, begin() == end(): " << (mp.rbegin() == mp.rend()) << std::endl;
+		return;
+	}
+	std::cout << "first: " << printPair(mp.begin(), false) << " | last: " << printPair(--mp.end(), false) << std::endl;
+	std::cout << "rbegin: " << mp.rbegin()->first << " | --rend: " << (--mp.rend())->first << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	printEnds(mp);
+	mp[50] = "fifty";
+	printEnds(mp);
+
+	// New smallest / biggest keys move the ends
+	mp[10] = "ten";
+	mp[90] = "ninety";
+	mp[30] = "thirty";
+	printEnds(mp);
+
+	// end() stays the same node, iterators to it are still end() after inserts and erases
+	ft_mp::iterator end = mp.end();
+	mp[100] = "hundred";
+	mp.erase(10);
+	std::cout << "end still end: " << (end == mp.end()) << std::endl;
+	printEnds(mp);
+
+	// Walking back from end() and forward from begin() meet every element
+	printReverse(mp);
+	ft_mp::iterator it = mp.end();
+	for (--it; it != mp.begin(); --it)
+		;
+	std::cout << "back to begin: " << it->first << std::endl;
+
+	mp.erase(mp.begin());
+	mp.erase(--mp.end());
+	printEnds(mp);
+	mp.erase(mp.begin(), mp.end());
+	printEnds(mp);
+
+	mp[-1] = "minus one";
+	printEnds(mp);
+
+	return (0);
+}
@@ -0,0 +1,59 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+static int iter = 0;
+
+static void	ft_insert(ft_mp &mp, ft_mp::iterator hint, T3 const &val)
+{
+	ft_mp::iterator ret = mp.insert(hint, val);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "returned: " << printPair(ret, false) << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	// Good hints: right place, at the end, at the beginning
+	ft_insert(mp, mp.end(), T3(10, "ten"));
+	ft_insert(mp, mp.end(), T3(20, "twenty"));
+	ft_insert(mp, mp.end(), T3(30, "thirty"));
+	ft_insert(mp, mp.begin(), T3(5, "five"));
+	ft_insert(mp, mp.find(20), T3(15, "fifteen"));
+	ft_insert(mp, mp.find(30), T3(25, "twenty five"));
+
+	// Bad hints, still inserted at the right place
+	ft_insert(mp, mp.begin(), T3(100, "hundred"));
+	ft_insert(mp, mp.end(), T3(1, "one"));
+	ft_insert(mp, mp.find(5), T3(22, "twenty two"));
+
+	// Keys already there, nothing changes, the existing element is returned
+	ft_insert(mp, mp.find(20), T3(20, "again"));
+	ft_insert(mp, mp.end(), T3(100, "again"));
+	ft_insert(mp, mp.begin(), T3(22, "again"));
+	printSize(mp);
+	printReverse(mp);
+
+	// Sorted input hinted at end(), the usual way to fill a map in order
+	ft_mp sorted;
+	for (int i = 0; i < 50; ++i)
+		sorted.insert(sorted.end(), T3(i * 2, "x"));
+	ft_mp::iterator it = sorted.end();
+	for (int i = 99; i > 0; i -= 2)
+		it = sorted.insert(it, T3(i, "y"));
+	std::cout << "size: " << sorted.size() << " | first: " << sorted.begin()->first << " | last: " << sorted.rbegin()->first << std::endl;
+	int expected = 0;
+	for (it = sorted.begin(); it != sorted.end(); ++it, ++expected)
+	{
+		if (it->first != expected)
+			std::cout << "wrong order at " << expected << std::endl;
+	}
+
+	return (0);
+}
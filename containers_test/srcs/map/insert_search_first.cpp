@@ -0,0 +1,43 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+static int iter = 0;
+
+static void	ft_insert(ft_mp &mp, T3 const &val)
+{
+	_pair<ft_mp::iterator, bool> ret = mp.insert(val);
+
+	std::cout << "\t-- [" << iter++ << "] --" << std::endl;
+	std::cout << "inserted: " << ret.second << " | points to: " << printPair(ret.first, false) << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	ft_insert(mp, T3(42, 1));
+	ft_insert(mp, T3(21, 2));
+	ft_insert(mp, T3(84, 3));
+
+	// Key already there: nothing replaced, the iterator is the element we had
+	ft_insert(mp, T3(42, 100));
+	ft_insert(mp, T3(21, 200));
+
+	// The iterator returned is usable right away
+	_pair<ft_mp::iterator, bool> ret = mp.insert(T3(63, 4));
+	++ret.first;
+	std::cout << "after 63: " << printPair(ret.first, false) << std::endl;
+
+	// operator[] on a key we have returns it's value, on a missing one inserts a default
+	std::cout << "mp[84]: " << mp[84] << std::endl;
+	std::cout << "mp[7]: " << mp[7] << std::endl;
+	mp[7] = 7;
+	printSize(mp);
+
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+#define T1 int
+
+// No default constructor: lookups and erase by key must never need to build a value
+class Mapped {
+	public:
+		explicit Mapped(int value) : _value(value) { }
+		int	get(void) const { return (this->_value); }
+	private:
+		int	_value;
+};
+
+std::ostream	&operator<<(std::ostream &o, Mapped const &m) {
+	o << "Mapped(" << m.get() << ")";
+	return o;
+}
+
+typedef TESTED_NAMESPACE::map<T1, Mapped> ft_mp;
+typedef _pair<const T1, Mapped> T3;
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 10; ++i)
+		mp.insert(T3(i * 10, Mapped(i)));
+
+	std::cout << "find(30): " << printPair(mp.find(30), false) << std::endl;
+	std::cout << "find(35) is end: " << (mp.find(35) == mp.end()) << std::endl;
+	std::cout << "count(40): " << mp.count(40) << " | count(41): " << mp.count(41) << std::endl;
+	std::cout << "lower_bound(45): " << printPair(mp.lower_bound(45), false) << std::endl;
+	std::cout << "upper_bound(50): " << printPair(mp.upper_bound(50), false) << std::endl;
+	std::cout << "equal_range(60): " << printPair(mp.equal_range(60).first, false) << std::endl;
+
+	const ft_mp &cmp = mp;
+	std::cout << "const find(90): " << printPair(cmp.find(90), false) << std::endl;
+	std::cout << "const lower_bound(-1): " << printPair(cmp.lower_bound(-1), false) << std::endl;
+
+	std::cout << "erase(20): " << mp.erase(20) << " | erase(25): " << mp.erase(25) << std::endl;
+	printSize(mp);
+
+	return (0);
+}
@@ -0,0 +1,102 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// pool_stats is not in std: std has no counts, and every check prints what ft should
+struct poolCounts
+{
+	size_t capacity;
+	size_t live;
+	size_t free;
+};
+
+static poolCounts	countsOf(ft_mp const &mp)
+{
+	poolCounts ret = { 0, 0, 0 };
+#if !defined(USING_STD)
+	ft_mp::pool_stats_type stats = mp.pool_stats();
+	ret.capacity = stats.capacity;
+	ret.live = stats.live;
+	ret.free = stats.free;
+#else
+	(void)mp;
+#endif
+	return (ret);
+}
+
+#if !defined(USING_STD)
+# define POOL_CHECK(expr) (expr)
+#else
+# define POOL_CHECK(expr) ((void)(expr), true)
+#endif
+
+static void	check(const char *what, bool ok)
+{
+	std::cout << what << ": " << ok << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 5000; ++i)
+		mp[i] = "value";
+	poolCounts filled = countsOf(mp);
+	check("one live node per element", POOL_CHECK(filled.live == mp.size()));
+
+	// Erased nodes go on the free list, the next inserts take them back instead of growing the pool
+	for (int i = 0; i < 5000; i += 2)
+		mp.erase(i);
+	poolCounts erased = countsOf(mp);
+	check("erased nodes are free", POOL_CHECK(erased.free == filled.free + 2500 && erased.capacity == filled.capacity));
+	for (int i = 0; i < 5000; i += 2)
+		mp[i] = "again";
+	poolCounts refilled = countsOf(mp);
+	check("free nodes are reused", POOL_CHECK(refilled.free == filled.free && refilled.capacity == filled.capacity));
+
+	// Churn of the same size never grows the pool, and iterators to the elements left stay valid
+	ft_mp::iterator kept = mp.find(2500);
+	for (int round = 0; round < 10; ++round)
+	{
+		for (int i = 0; i < 5000; i += 2)
+			if (i != 2500)
+				mp.erase(i);
+		for (int i = 0; i < 5000; i += 2)
+			mp[i] = "again";
+	}
+	check("no growth after churn", POOL_CHECK(countsOf(mp).capacity == filled.capacity));
+	std::cout << "kept: " << printPair(kept, false) << std::endl;
+	std::cout << "size: " << mp.size() << std::endl;
+
+	// Kept through clear, refilled without allocating
+#if !defined(USING_STD)
+	mp.keep_nodes_on_clear(true);
+#endif
+	mp.clear();
+	poolCounts cleared = countsOf(mp);
+	check("kept on clear", POOL_CHECK(cleared.capacity == filled.capacity && cleared.live == 0
+									  && cleared.free == cleared.capacity));
+	for (int i = 0; i < 100; ++i)
+		mp[i * i] = "square";
+	poolCounts squares = countsOf(mp);
+	check("refilled from kept nodes", POOL_CHECK(squares.capacity == filled.capacity && squares.free == cleared.free - 100));
+	std::cout << "first: " << printPair(mp.begin(), false) << " | last: " << printPair(--mp.end(), false) << std::endl;
+
+	// Copies have their own nodes (and keep them on clear like the original), given back on clear when not kept
+	ft_mp copy(mp);
+	copy.erase(copy.begin());
+	poolCounts copied = countsOf(copy);
+	check("copy has it's own pool", POOL_CHECK(copied.live == 99 && countsOf(mp).live == 100));
+#if !defined(USING_STD)
+	copy.keep_nodes_on_clear(false);
+#endif
+	copy.clear();
+	check("released on clear", POOL_CHECK(countsOf(copy).capacity == 0));
+	mp.clear();
+	check("still kept", POOL_CHECK(countsOf(mp).capacity == filled.capacity));
+
+	return (0);
+}
@@ -0,0 +1,63 @@
+#define FT_ORDER_STATISTICS
+#include "common.hpp"
+#include <iterator>
+
+#define T1 int
+#define T2 int
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// nth / rank / distance are not in std, std walks the map to give what ft should
+#if !defined(USING_STD)
+static ft_mp::iterator	nth(ft_mp &mp, size_t n) { return (mp.nth(n)); }
+static size_t			rank(ft_mp const &mp, T1 k) { return (mp.rank(k)); }
+static ft_mp::difference_type	dist(ft_mp const &mp, ft_mp::const_iterator first, ft_mp::const_iterator last) { return (mp.distance(first, last)); }
+#else
+static ft_mp::iterator	nth(ft_mp &mp, size_t n)
+{
+	if (n >= mp.size())
+		return (mp.end());
+	ft_mp::iterator it = mp.begin();
+	std::advance(it, n);
+	return (it);
+}
+static size_t			rank(ft_mp const &mp, T1 k) { return (std::distance(mp.begin(), mp.lower_bound(k))); }
+static ft_mp::difference_type	dist(ft_mp const &mp, ft_mp::const_iterator first, ft_mp::const_iterator last) { (void)mp; return (std::distance(first, last)); }
+#endif
+
+static void	printStats(ft_mp &mp)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	for (size_t n = 0; n < mp.size(); n += mp.size() / 7 + 1)
+		std::cout << "nth(" << n << "): " << printPair(nth(mp, n), false) << std::endl;
+	std::cout << "nth(size) is end: " << (nth(mp, mp.size()) == mp.end()) << std::endl;
+	std::cout << "rank(-1): " << rank(mp, -1) << " | rank(500): " << rank(mp, 500) << " | rank(501): " << rank(mp, 501)
+			  << " | rank(100000): " << rank(mp, 100000) << std::endl;
+	std::cout << "distance(begin, end): " << dist(mp, mp.begin(), mp.end()) << std::endl;
+	if (!mp.empty())
+		std::cout << "distance(lower_bound(250), lower_bound(750)): " << dist(mp, mp.lower_bound(250), mp.lower_bound(750)) << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	printStats(mp);
+	for (int i = 0; i < 1000; ++i)
+		mp[(i * 17) % 1000] = i;
+	printStats(mp);
+
+	// Counts follow erases, range erases and inserts
+	for (int i = 0; i < 1000; i += 4)
+		mp.erase(i);
+	mp.erase(mp.find(301), mp.find(601));
+	mp[5000] = 1;
+	printStats(mp);
+
+	// And copies
+	ft_mp copy(mp);
+	copy.erase(copy.begin(), nth(copy, 100));
+	printStats(copy);
+
+	return (0);
+}
@@ -0,0 +1,55 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+static void	printCount(ft_mp const &mp)
+{
+	std::cout << "size: " << mp.size() << " | empty: " << mp.empty() << std::endl;
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	printCount(mp);
+	for (int i = 0; i < 1000; ++i)
+		mp[(i * 7) % 1000] = i;
+	printCount(mp);
+
+	mp.insert(_pair<const T1, T2>(3, 3)); // Already there, size doesn't move
+	mp[500] = 42;
+	printCount(mp);
+
+	std::cout << "erase missing key: " << mp.erase(5000) << std::endl;
+	std::cout << "erase key: " << mp.erase(10) << std::endl;
+	printCount(mp);
+
+	mp.erase(mp.begin());
+	mp.erase(--mp.end());
+	printCount(mp);
+
+	mp.erase(mp.find(100), mp.find(200));
+	printCount(mp);
+
+	ft_mp copy(mp);
+	ft_mp other;
+	other[1] = 1;
+	copy.swap(other);
+	printCount(copy);
+	printCount(other);
+
+	other = copy;
+	printCount(other);
+
+	mp.clear();
+	printCount(mp);
+	mp[1] = 1;
+	printCount(mp);
+	mp.erase(1);
+	printCount(mp);
+
+	return (0);
+}
@@ -0,0 +1,67 @@
+#include "common.hpp"
+#include <list>
+#include <vector>
+
+#define T1 int
+#define T2 std::string
+typedef _pair<const T1, T2> T3;
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// ft::sorted_unique tells the range is already sorted without duplicates, std has no such thing
+#if !defined(USING_STD)
+# define SORTED_UNIQUE ft::sorted_unique,
+#else
+# define SORTED_UNIQUE
+#endif
+
+int		main(void)
+{
+	std::vector<T3> sorted;
+	for (int i = 0; i < 31; ++i)
+		sorted.push_back(T3(i * 2, std::string(1, 'a' + i % 26)));
+
+	// Built straight from the sorted range, then used like any map
+	ft_mp mp(sorted.begin(), sorted.end());
+	printSize(mp);
+	mp[7] = "seven";
+	mp.erase(0);
+	mp.erase(30);
+	printReverse(mp);
+
+	// Not sorted, or with duplicates: the first of equal keys is kept
+	std::list<T3> lst;
+	lst.push_back(T3(5, "first five"));
+	lst.push_back(T3(1, "one"));
+	lst.push_back(T3(5, "second five"));
+	lst.push_back(T3(3, "three"));
+	lst.push_back(T3(1, "second one"));
+	ft_mp unsorted(lst.begin(), lst.end());
+	printSize(unsorted);
+
+	std::list<T3> dups;
+	dups.push_back(T3(1, "one"));
+	dups.push_back(T3(2, "two"));
+	dups.push_back(T3(2, "second two"));
+	dups.push_back(T3(3, "three"));
+	ft_mp withDups(dups.begin(), dups.end());
+	printSize(withDups);
+
+	// Sorted range into a map that already has some of the keys: ours stay
+	withDups.insert(sorted.begin(), sorted.begin() + 5);
+	printSize(withDups);
+
+	// Trusted sorted ranges, from a vector and from another map
+	ft_mp trusted(SORTED_UNIQUE sorted.begin(), sorted.end());
+	std::cout << "equal: " << (trusted == ft_mp(sorted.begin(), sorted.end())) << std::endl;
+	ft_mp fromMap(SORTED_UNIQUE mp.begin(), mp.end());
+	std::cout << "equal: " << (fromMap == mp) << std::endl;
+	ft_mp empty;
+	empty.insert(SORTED_UNIQUE sorted.begin(), sorted.begin() + 3);
+	printSize(empty);
+
+	// Empty ranges
+	ft_mp none(sorted.begin(), sorted.begin());
+	printSize(none);
+
+	return (0);
+}
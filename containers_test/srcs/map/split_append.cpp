@@ -0,0 +1,86 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::map<T1, T2> ft_mp;
+
+// Not in std, std does by hand what ft should: move what's from k on to out / move x's keys we don't have here
+#if !defined(USING_STD)
+static void	splitOff(ft_mp &mp, T1 k, ft_mp &out) { mp.split_off(k, out); }
+static void	append(ft_mp &mp, ft_mp &x) { mp.append(x); }
+#else
+static void	splitOff(ft_mp &mp, T1 k, ft_mp &out)
+{
+	out.clear();
+	out.insert(mp.lower_bound(k), mp.end());
+	mp.erase(mp.lower_bound(k), mp.end());
+}
+static void	append(ft_mp &mp, ft_mp &x)
+{
+	for (ft_mp::iterator it = x.begin(); it != x.end();)
+	{
+		if (mp.insert(*it).second)
+			x.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+int		main(void)
+{
+	ft_mp mp;
+
+	for (int i = 0; i < 40; ++i)
+		mp[i * 5] = std::string(1, 'a' + i % 26);
+
+	// Split in the middle, on a missing key, before everything and after everything. out's old content goes away
+	ft_mp high;
+	high[1000] = "old";
+	splitOff(mp, 100, high);
+	printSize(mp);
+	printSize(high);
+	ft_mp higher;
+	splitOff(high, 152, higher);
+	std::cout << "high: " << high.size() << " | higher: " << higher.size() << " | first: " << higher.begin()->first << std::endl;
+	ft_mp none;
+	splitOff(mp, 1000, none);
+	std::cout << "mp: " << mp.size() << " | none: " << none.size() << std::endl;
+	ft_mp all;
+	splitOff(mp, -1, all);
+	std::cout << "mp: " << mp.size() << " | all: " << all.size() << " | empty: " << mp.empty() << std::endl;
+
+	// Both halves still work as maps
+	all[3] = "three";
+	all.erase(10);
+	higher[151] = "hundred fifty one";
+	printReverse(higher);
+
+	// Appended back: after ours, before ours, into an empty map
+	append(all, high);
+	std::cout << "all: " << all.size() << " | high: " << high.size() << std::endl;
+	append(higher, all);
+	std::cout << "higher: " << higher.size() << " | all: " << all.size() << std::endl;
+	append(mp, higher);
+	printSize(mp);
+
+	// Overlapping keys: the ones we don't have move, the colliding ones stay in x
+	ft_mp other;
+	other[-5] = "minus five";
+	other[3] = "three again";
+	other[50] = "fifty again";
+	other[52] = "fifty two";
+	other[1000] = "thousand";
+	append(mp, other);
+	printSize(mp);
+	printSize(other);
+
+	// Appending an empty map, and appending into one
+	ft_mp empty;
+	append(mp, empty);
+	append(empty, other);
+	std::cout << "mp: " << mp.size() << " | empty: " << empty.size() << " | other: " << other.size() << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,79 @@
+#include "common.hpp"
+
+#define T1 int
+
+struct ft_more {
+	bool	operator()(const T1 &first, const T1 &second) const {
+		return (first > second);
+	}
+};
+
+typedef TESTED_NAMESPACE::set<T1, ft_more> ft_st;
+
+template <typename SET>
+void	ft_bound(SET &st, const T1 &param)
+{
+	typename SET::iterator ite = st.end(), it[2];
+	_pair<typename SET::iterator, typename SET::iterator> ft_range;
+
+	it[0] = st.lower_bound(param); it[1] = st.upper_bound(param);
+	ft_range = st.equal_range(param);
+	std::cout << "with key [" << param << "]:" << std::endl;
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+}
+
+template <typename SET>
+void	ft_const_bound(const SET &st, const T1 &param)
+{
+	typename SET::const_iterator ite = st.end(), it[2];
+	_pair<typename SET::const_iterator, typename SET::const_iterator> ft_range;
+
+	it[0] = st.lower_bound(param); it[1] = st.upper_bound(param);
+	ft_range = st.equal_range(param);
+	std::cout << "[const] with key [" << param << "]:" << std::endl;
+	std::cout << "lower_bound: " << (it[0] == ite ? "end()" : printPair(it[0], false)) << std::endl;
+	std::cout << "upper_bound: " << (it[1] == ite ? "end()" : printPair(it[1], false)) << std::endl;
+	std::cout << "equal_range: " << (ft_range.first == it[0] && ft_range.second == it[1]) << std::endl;
+}
+
+int		main(void)
+{
+	ft_st st;
+
+	ft_bound(st, 42); // Empty
+	for (int i = 1; i <= 100; ++i)
+		st.insert(i * 3);
+	std::cout << "size: " << st.size() << std::endl;
+
+	// Keys in the set, between two keys, before the first (biggest) and after the last (smallest)
+	ft_bound(st, 300);
+	ft_bound(st, 150);
+	ft_bound(st, 151);
+	ft_bound(st, 3);
+	ft_bound(st, 1000);
+	ft_bound(st, 0);
+
+	ft_const_bound(st, 99);
+	ft_const_bound(st, 98);
+	ft_const_bound(st, -5);
+
+	// Bounds of every key agree with a walk
+	int errors = 0;
+	for (int k = -2; k < 310; ++k)
+	{
+		ft_st::iterator it = st.begin();
+		while (it != st.end() && *it > k)
+			++it;
+		if (st.lower_bound(k) != it)
+			++errors;
+		if (it != st.end() && *it == k)
+			++it;
+		if (st.upper_bound(k) != it)
+			++errors;
+	}
+	std::cout << "errors: " << errors << std::endl;
+
+	return (0);
+}
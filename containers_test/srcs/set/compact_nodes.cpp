@@ -0,0 +1,42 @@
+#define FT_COMPACT_NODES
+#include "common.hpp"
+
+// Color packed in the parent pointer: small values (char) and lots of rotations both ways
+template <typename SET>
+void	churn(SET &st, int n)
+{
+	for (int i = 0; i < n; ++i)
+		st.insert(static_cast<typename SET::value_type>((i * 37) % n));
+	for (int i = 0; i < n; i += 3)
+		st.erase(static_cast<typename SET::value_type>(i));
+	for (int i = n - 1; i >= 0; i -= 2)
+		st.insert(static_cast<typename SET::value_type>(i));
+}
+
+int		main(void)
+{
+	TESTED_NAMESPACE::set<char> chars;
+	churn(chars, 120);
+	std::cout << "size: " << chars.size() << std::endl;
+	std::cout << "first: " << static_cast<int>(*chars.begin()) << " | last: " << static_cast<int>(*chars.rbegin()) << std::endl;
+
+	TESTED_NAMESPACE::set<int> ints;
+	churn(ints, 5000);
+	std::cout << "size: " << ints.size() << std::endl;
+
+	// Walks both ways go through parents
+	int forward = 0;
+	for (TESTED_NAMESPACE::set<int>::iterator it = ints.begin(); it != ints.end(); ++it)
+		++forward;
+	int backward = 0;
+	for (TESTED_NAMESPACE::set<int>::reverse_iterator it = ints.rbegin(); it != ints.rend(); ++it)
+		++backward;
+	std::cout << "forward: " << forward << " | backward: " << backward << std::endl;
+
+	TESTED_NAMESPACE::set<int> copy(ints);
+	copy.erase(copy.find(100), copy.find(4000));
+	std::cout << "size: " << copy.size() << std::endl; // Smaller nodes, max_size() is not std's
+	printReverse(copy);
+
+	return (0);
+}
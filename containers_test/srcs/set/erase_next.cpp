@@ -0,0 +1,42 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef TESTED_NAMESPACE::set<T1> ft_st;
+
+// C++98 std::set::erase returns nothing, std gives what ft should return: the value after the erased one(s)
+#if !defined(USING_STD)
+static ft_st::iterator	eraseNext(ft_st &st, ft_st::iterator pos) { return (st.erase(pos)); }
+static ft_st::iterator	eraseNext(ft_st &st, ft_st::iterator first, ft_st::iterator last) { return (st.erase(first, last)); }
+#else
+static ft_st::iterator	eraseNext(ft_st &st, ft_st::iterator pos) { st.erase(pos++); return (pos); }
+static ft_st::iterator	eraseNext(ft_st &st, ft_st::iterator first, ft_st::iterator last) { st.erase(first, last); return (last); }
+#endif
+
+int		main(void)
+{
+	ft_st st;
+
+	for (int i = 0; i < 1000; ++i)
+		st.insert((i * 37) % 1000);
+
+	// Every third value erased while walking, the others kept
+	int n = 0;
+	for (ft_st::iterator it = st.begin(); it != st.end(); ++n)
+	{
+		if (n % 3 == 0)
+			it = eraseNext(st, it);
+		else
+			++it;
+	}
+	std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+
+	ft_st::iterator next = eraseNext(st, st.lower_bound(500), st.lower_bound(600));
+	std::cout << "next: " << *next << " | size: " << st.size() << std::endl;
+	next = eraseNext(st, --st.end());
+	std::cout << "next is end: " << (next == st.end()) << " | size: " << st.size() << std::endl;
+	next = eraseNext(st, st.begin(), st.end());
+	std::cout << "next is end: " << (next == st.end()) << " | size: " << st.size() << std::endl;
+
+	return (0);
+}
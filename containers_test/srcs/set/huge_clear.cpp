@@ -0,0 +1,48 @@
+#include "common.hpp"
+
+#define T1 std::string
+
+typedef TESTED_NAMESPACE::set<T1> ft_st;
+
+static std::string	key(int i)
+{
+	std::string ret;
+
+	for (; i > 0; i /= 26)
+		ret += static_cast<char>('a' + i % 26);
+	return (ret);
+}
+
+int		main(void)
+{
+	ft_st st;
+
+	// Big enough that a recursive teardown would go deep if the tree was not balanced
+	for (int i = 0; i < 200000; ++i)
+		st.insert(key(i));
+	std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+
+	// Cleared then refilled, several times
+	for (int round = 0; round < 3; ++round)
+	{
+		st.clear();
+		std::cout << "cleared: " << st.size() << " | empty: " << st.empty() << std::endl;
+		for (int i = round; i < 50000; i += 3)
+			st.insert(key(i));
+		std::cout << "size: " << st.size() << " | first: " << *st.begin() << " | last: " << *st.rbegin() << std::endl;
+	}
+
+	// Copies destroyed at the end of their scope, and a set swapped with an empty one
+	{
+		ft_st copy(st);
+		ft_st other;
+		other.swap(copy);
+		std::cout << "copy: " << copy.size() << " | other: " << other.size() << std::endl;
+	}
+	ft_st last(st);
+	st.clear();
+	st.clear();
+	std::cout << "size: " << st.size() << " | last: " << last.size() << std::endl;
+
+	return (0);
+}
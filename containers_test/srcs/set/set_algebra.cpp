@@ -0,0 +1,97 @@
+#include "common.hpp"
+#include <algorithm>
+#include <iterator>
+
+#define T1 int
+
+typedef TESTED_NAMESPACE::set<T1> ft_st;
+
+// Not in std::set, std uses the <algorithm> ones to give what ft should
+#if !defined(USING_STD)
+static ft_st	setUnion(ft_st const &a, ft_st const &b) { return (a.set_union(b)); }
+static ft_st	setIntersection(ft_st const &a, ft_st const &b) { return (a.set_intersection(b)); }
+static ft_st	setDifference(ft_st const &a, ft_st const &b) { return (a.set_difference(b)); }
+static void		merge(ft_st &a, ft_st &b) { a.merge(b); }
+#else
+static ft_st	setUnion(ft_st const &a, ft_st const &b)
+{
+	ft_st ret;
+	std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::inserter(ret, ret.end()));
+	return (ret);
+}
+static ft_st	setIntersection(ft_st const &a, ft_st const &b)
+{
+	ft_st ret;
+	std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::inserter(ret, ret.end()));
+	return (ret);
+}
+static ft_st	setDifference(ft_st const &a, ft_st const &b)
+{
+	ft_st ret;
+	std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::inserter(ret, ret.end()));
+	return (ret);
+}
+static void		merge(ft_st &a, ft_st &b)
+{
+	for (ft_st::iterator it = b.begin(); it != b.end();)
+	{
+		if (a.insert(*it).second)
+			b.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+// Size and content, without max_size() (node sizes are not std's)
+static void	printContent(ft_st const &st)
+{
+	std::cout << "size: " << st.size() << " |";
+	for (ft_st::const_iterator it = st.begin(); it != st.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+static void	printAll(ft_st const &a, ft_st const &b)
+{
+	printContent(setUnion(a, b));
+	printContent(setIntersection(a, b));
+	printContent(setDifference(a, b));
+	printContent(setDifference(b, a));
+}
+
+int		main(void)
+{
+	ft_st evens, threes, empty;
+
+	for (int i = 0; i < 30; i += 2)
+		evens.insert(i);
+	for (int i = 0; i < 30; i += 3)
+		threes.insert(i);
+
+	printAll(evens, threes);
+	printAll(evens, empty);
+	printAll(evens, evens);
+
+	// Very different sizes (the small one is searched in the big one)
+	ft_st big, small;
+	for (int i = 0; i < 100000; ++i)
+		big.insert(i * 2);
+	small.insert(-1);
+	small.insert(4);
+	small.insert(199999);
+	small.insert(199998);
+	printContent(setIntersection(big, small));
+	printContent(setIntersection(small, big));
+	printContent(setDifference(small, big));
+	std::cout << "union: " << setUnion(big, small).size() << " | difference: " << setDifference(big, small).size() << std::endl;
+
+	// merge moves what we don't have, the rest stays
+	merge(evens, threes);
+	printContent(evens);
+	printContent(threes);
+	merge(small, big);
+	std::cout << "small: " << small.size() << " | big: " << big.size() << std::endl;
+
+	return (0);
+}
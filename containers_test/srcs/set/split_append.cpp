@@ -0,0 +1,59 @@
+#define FT_ORDER_STATISTICS
+#include "common.hpp"
+
+#define T1 int
+
+typedef TESTED_NAMESPACE::set<T1> ft_st;
+
+// Not in std, std does by hand what ft should (see map/split_append.cpp), here with the sizes kept by the counts
+#if !defined(USING_STD)
+static void	splitOff(ft_st &st, T1 k, ft_st &out) { st.split_off(k, out); }
+static void	append(ft_st &st, ft_st &x) { st.append(x); }
+#else
+static void	splitOff(ft_st &st, T1 k, ft_st &out)
+{
+	out.clear();
+	out.insert(st.lower_bound(k), st.end());
+	st.erase(st.lower_bound(k), st.end());
+}
+static void	append(ft_st &st, ft_st &x)
+{
+	for (ft_st::iterator it = x.begin(); it != x.end();)
+	{
+		if (st.insert(*it).second)
+			x.erase(it++);
+		else
+			++it;
+	}
+}
+#endif
+
+int		main(void)
+{
+	ft_st st;
+
+	for (int i = 0; i < 10000; ++i)
+		st.insert(i);
+
+	// Cut in pieces of 1000 then put back together, last piece first
+	ft_st pieces[10];
+	for (int i = 9; i > 0; --i)
+		splitOff(st, i * 1000, pieces[i]);
+	std::cout << "st: " << st.size() << " | last: " << *st.rbegin() << std::endl;
+	for (int i = 1; i < 10; ++i)
+		std::cout << "piece " << i << ": " << pieces[i].size() << " | first: " << *pieces[i].begin() << std::endl;
+	for (int i = 8; i > 0; --i)
+		append(pieces[i], pieces[i + 1]);
+	append(st, pieces[1]);
+	std::cout << "st: " << st.size() << " | pieces[1]: " << pieces[1].size() << std::endl;
+
+	// Overlap, 5000 is already there
+	ft_st other;
+	other.insert(5000);
+	other.insert(20000);
+	append(st, other);
+	printSize(other);
+	std::cout << "st: " << st.size() << " | last: " << *st.rbegin() << std::endl;
+
+	return (0);
+}
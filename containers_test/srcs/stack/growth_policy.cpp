@@ -0,0 +1,72 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "growth_policy.hpp"
+#else
+# include <vector>
+#endif
+
+// Grows one at a time, less than what's required when a range comes in (taken as required then)
+struct one_by_one {
+	static size_t	next(size_t capacity, size_t required, size_t elementSize) {
+		(void)required; (void)elementSize;
+		return (capacity + 1);
+	}
+};
+
+struct item {
+	int	value;
+};
+
+std::ostream	&operator<<(std::ostream &o, item const &i) {
+	o << "item " << i.value;
+	return o;
+}
+
+// Growth policies are not in std, std stacks on a plain vector to give what ft should
+#if !defined(USING_STD)
+# define GROWN_VECTOR(T, Growth) ft::vector<T, std::allocator<T>, Growth >
+namespace ft { template <> struct default_growth<item> { typedef ft::one_and_half_growth type; }; }
+#else
+# define GROWN_VECTOR(T, Growth) std::vector<T>
+#endif
+
+template <typename STACK>
+void	fill(STACK stck, int n)
+{
+	for (int i = 0; i < n; ++i)
+		stck.push(i * 3);
+	for (int i = 0; i < n / 2; ++i)
+		stck.pop();
+	stck.push(-1);
+	printSize(stck);
+}
+
+int		main(void)
+{
+	fill(TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, ft::doubling_growth)>(), 20);
+	fill(TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, ft::one_and_half_growth)>(), 20);
+	fill(TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, ft::page_growth)>(), 20);
+	fill(TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, ft::capped_growth<16>)>(), 20);
+	fill(TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, one_by_one)>(), 20);
+
+	// Range inserts need more than one step of some policies
+	GROWN_VECTOR(int, one_by_one) vct;
+	vct.push_back(1);
+	vct.insert(vct.end(), 50, 7);
+	GROWN_VECTOR(int, one_by_one) head(10, 3);
+	vct.insert(vct.begin(), head.begin(), head.end());
+	std::cout << "size: " << vct.size() << " | capacity: " << (vct.capacity() >= vct.size() ? "OK" : "KO") << std::endl;
+	TESTED_NAMESPACE::stack<int, GROWN_VECTOR(int, one_by_one)> fromVector(vct);
+	std::cout << "top: " << fromVector.top() << " | size: " << fromVector.size() << std::endl;
+
+	// Default stack of a type whose default policy was changed
+	TESTED_NAMESPACE::stack<item> items;
+	for (int i = 0; i < 10; ++i)
+	{
+		item it = { i };
+		items.push(it);
+	}
+	printSize(items);
+
+	return (0);
+}
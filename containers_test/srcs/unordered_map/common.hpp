@@ -0,0 +1,38 @@
+#include "../base.hpp"
+#include <vector>
+#include <algorithm>
+#if !defined(USING_STD)
+# include "unordered_map.hpp"
+#else
+# include <map>
+# define unordered_map map // No std::unordered_map in C++98, std::map gives the same content in order
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// Content sorted by key, iteration order is the table's own otherwise
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		std::vector<std::pair<typename T_MAP::key_type, typename T_MAP::mapped_type> > content;
+		for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it)
+			content.push_back(std::make_pair(it->first, it->second));
+		std::sort(content.begin(), content.end());
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (size_t i = 0; i < content.size(); ++i)
+			std::cout << "- key: " << content[i].first << " | value: " << content[i].second << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
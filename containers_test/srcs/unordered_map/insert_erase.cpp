@@ -0,0 +1,83 @@
+#include "common.hpp"
+#include <list>
+
+#define T1 int
+#define T2 std::string
+
+typedef TESTED_NAMESPACE::unordered_map<T1, T2> ft_mp;
+typedef _pair<const T1, T2> T3;
+
+// Not in std::map: the table keeps it's load under the max (std prints what ft should)
+static void	printLoad(ft_mp const &mp)
+{
+#if !defined(USING_STD)
+	std::cout << "load ok: " << (mp.load_factor() <= mp.max_load_factor()) << std::endl;
+#else
+	(void)mp;
+	std::cout << "load ok: " << 1 << std::endl;
+#endif
+}
+
+int		main(void)
+{
+	ft_mp mp;
+
+	printSize(mp);
+	// Keys that land in the same groups (multiples of a power of 2) and plain ones, through many grows
+	for (int i = 0; i < 3000; ++i)
+		mp[i * 1024] = "spread";
+	for (int i = 0; i < 3000; ++i)
+		mp[i] = "dense";
+	std::cout << "size: " << mp.size() << std::endl;
+	printLoad(mp);
+
+	_pair<ft_mp::iterator, bool> ret = mp.insert(T3(1024, "again"));
+	std::cout << "inserted: " << ret.second << " | " << printPair(ret.first, false) << std::endl;
+	ret = mp.insert(T3(-7, "minus seven"));
+	std::cout << "inserted: " << ret.second << " | " << printPair(ret.first, false) << std::endl;
+	std::cout << printPair(mp.insert(mp.begin(), T3(-8, "hinted")), false) << std::endl;
+
+	// Erased slots are skipped by lookups and reused by inserts
+	int erased = 0;
+	for (int i = 0; i < 3000; i += 2)
+		erased += mp.erase(i);
+	std::cout << "erased: " << erased << " | size: " << mp.size() << std::endl;
+	std::cout << "count(2): " << mp.count(2) << " | count(3): " << mp.count(3) << " | count(2048): " << mp.count(2048) << std::endl;
+	for (int i = 0; i < 3000; i += 4)
+		mp[i] = "back";
+	std::cout << "size: " << mp.size() << " | mp[4]: " << mp[4] << " | mp[5]: " << mp[5] << " | find(6) is end: "
+			  << (mp.find(6) == mp.end()) << std::endl;
+	mp.erase(mp.find(5));
+	std::cout << "count(5): " << mp.count(5) << std::endl;
+
+	// A free slot before the key on it's way must not make operator[] or insert miss it
+	mp.erase(0);
+	mp.erase(1024);
+	mp[2048] = "found";
+	ret = mp.insert(T3(3072, "not inserted"));
+	std::cout << "size: " << mp.size() << " | mp[2048]: " << mp[2048] << " | inserted: " << ret.second << " | "
+			  << printPair(ret.first, false) << std::endl;
+
+#if !defined(USING_STD)
+	mp.rehash(100000);
+	mp.reserve(10);
+#endif
+	printLoad(mp);
+	std::cout << "size: " << mp.size() << " | mp[3000 * 1024]: [" << mp[3000 * 1024] << "]" << std::endl;
+
+	std::list<T3> lst;
+	for (int i = 0; i < 10; ++i)
+		lst.push_back(T3(i % 6, std::string(1, 'a' + i)));
+	ft_mp small(lst.begin(), lst.end());
+	printSize(small);
+
+	ft_mp copy(mp);
+	mp.erase(mp.begin(), mp.end());
+	std::cout << "mp: " << mp.size() << " | empty: " << mp.empty() << " | copy: " << copy.size() << std::endl;
+	copy.swap(mp);
+	mp.clear();
+	mp[1] = "one";
+	printSize(mp);
+
+	return (0);
+}
@@ -0,0 +1,38 @@
+#include "../base.hpp"
+#include <vector>
+#include <algorithm>
+#if !defined(USING_STD)
+# include "unordered_set.hpp"
+#else
+# include <set>
+# define unordered_set set // No std::unordered_set in C++98, std::set gives the same content in order
+#endif /* !defined(STD) */
+
+#define _pair TESTED_NAMESPACE::pair
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "value: " << *iterator;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+// Content sorted, iteration order is the table's own otherwise
+template <typename T_SET>
+void	printSize(T_SET const &st, bool print_content = 1)
+{
+	std::cout << "size: " << st.size() << std::endl;
+	if (print_content)
+	{
+		std::vector<typename T_SET::value_type> content;
+		for (typename T_SET::const_iterator it = st.begin(); it != st.end(); ++it)
+			content.push_back(*it);
+		std::sort(content.begin(), content.end());
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (size_t i = 0; i < content.size(); ++i)
+			std::cout << "- value: " << content[i] << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
@@ -0,0 +1,45 @@
+#include "common.hpp"
+
+#define T1 std::string
+
+typedef TESTED_NAMESPACE::unordered_set<T1> ft_st;
+
+static std::string	key(int i)
+{
+	std::string ret("k");
+
+	for (; i > 0; i /= 26)
+		ret += static_cast<char>('a' + i % 26);
+	return (ret);
+}
+
+int		main(void)
+{
+	ft_st st;
+
+	for (int i = 0; i < 5000; ++i)
+		st.insert(key(i));
+	std::cout << "size: " << st.size() << " | insert again: " << st.insert(key(10)).second << std::endl;
+
+	for (int i = 0; i < 5000; i += 3)
+		st.erase(key(i));
+	std::cout << "size: " << st.size() << " | count(k): " << st.count(key(0)) << " | count(kb): " << st.count(key(1)) << std::endl;
+	for (int i = 0; i < 5000; i += 6)
+		st.insert(key(i));
+	std::cout << "size: " << st.size() << std::endl;
+
+	ft_st small;
+	small.insert("zeta");
+	small.insert("alpha");
+	small.insert("alpha");
+	small.insert("mu");
+	small.erase(small.find("mu"));
+	small.insert(small.end(), "omega");
+	printSize(small);
+
+	ft_st copy(st);
+	st.clear();
+	std::cout << "copy: " << copy.size() << " | st: " << st.size() << " | found: " << (copy.find(key(4)) != copy.end()) << std::endl;
+
+	return (0);
+}
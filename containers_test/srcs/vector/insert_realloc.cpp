@@ -0,0 +1,50 @@
+#include "common.hpp"
+#include <list>
+
+#define TESTED_TYPE std::string
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE> ft_vct;
+
+int		main(void)
+{
+	ft_vct vct;
+
+	for (int i = 0; i < 5; ++i)
+		vct.push_back(std::string(1, 'a' + i));
+	vct.reserve(5); // Full, every insert below has to reallocate
+
+	// The value inserted is one of our own elements, it must be read before it moves
+	vct.insert(vct.begin(), vct[4]);
+	printSize(vct);
+	vct.insert(vct.begin() + 2, 10, vct.back());
+	printSize(vct);
+	vct.insert(vct.end(), vct.size(), vct.front());
+	printSize(vct);
+
+	// Ranges bigger than what's left, at the beginning, in the middle, at the end
+	std::list<TESTED_TYPE> lst;
+	for (int i = 0; i < 40; ++i)
+		lst.push_back(std::string(i % 7 + 1, 'A' + i % 26));
+	ft_vct small(3, "x");
+	small.insert(small.begin(), lst.begin(), lst.end());
+	small.insert(small.begin() + 20, lst.begin(), lst.end());
+	small.insert(small.end(), lst.begin(), lst.end());
+	printSize(small);
+
+	// Enough room, nothing reallocates and the tail shifts
+	ft_vct roomy;
+	roomy.reserve(100);
+	for (int i = 0; i < 10; ++i)
+		roomy.push_back(std::string(3, '0' + i));
+	roomy.insert(roomy.begin() + 3, 4, "new");
+	roomy.insert(roomy.begin() + 1, lst.begin(), ++(++lst.begin()));
+	roomy.insert(roomy.begin() + 5, roomy[0]);
+	printSize(roomy);
+
+	// Nothing to insert
+	roomy.insert(roomy.begin(), 0, "none");
+	roomy.insert(roomy.end(), lst.begin(), lst.begin());
+	std::cout << "size: " << roomy.size() << std::endl;
+
+	return (0);
+}
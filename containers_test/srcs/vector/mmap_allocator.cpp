@@ -0,0 +1,102 @@
+#include "common.hpp"
+#if !defined(USING_STD)
+# include "mmap_allocator.hpp"
+# include <sys/mman.h>
+# include <unistd.h>
+# include <vector>
+# define MMAP_ALLOCATOR(T) ft::mmap_allocator<T>
+#else
+# define MMAP_ALLOCATOR(T) std::allocator<T> // Not in std, the content has to be the same anyway
+#endif
+
+typedef TESTED_NAMESPACE::vector<long, MMAP_ALLOCATOR(long) > ft_vct;
+typedef TESTED_NAMESPACE::vector<std::string, MMAP_ALLOCATOR(std::string) > ft_str_vct;
+
+static void	printSum(ft_vct const &vct)
+{
+	long sum = 0;
+
+	for (ft_vct::const_iterator it = vct.begin(); it != vct.end(); ++it)
+		sum += *it;
+	std::cout << "size: " << vct.size() << " | capacity: " << (vct.capacity() >= vct.size() ? "OK" : "KO")
+			  << " | sum: " << sum << std::endl;
+}
+
+// Not in std: pages after the last element are given back when the vector shrinks (std prints what ft should)
+static void	printReleased(ft_vct const &vct, const long *block)
+{
+#if !defined(USING_STD)
+	const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	const size_t used = (vct.size() * sizeof(long) + page - 1) / page;
+	const size_t pages = (vct.capacity() * sizeof(long) + page - 1) / page;
+# if defined(__APPLE__)
+	std::vector<char> resident(pages);
+# else
+	std::vector<unsigned char> resident(pages);
+# endif
+	bool released = (mincore(const_cast<long*>(block), pages * page, &resident[0]) == 0);
+	for (size_t i = used; i < pages && released; ++i)
+		released = !(resident[i] & 1);
+	std::cout << "released: " << released << std::endl;
+#else
+	(void)vct;
+	(void)block;
+	std::cout << "released: " << 1 << std::endl;
+#endif
+}
+
+int		main(void)
+{
+	ft_vct vct;
+
+	// Grows through many remaps, big enough for huge pages at the end
+	for (long i = 0; i < 1000000; ++i)
+		vct.push_back(i);
+	printSum(vct);
+	std::cout << "vct[0]: " << vct[0] << " | vct[999999]: " << vct[999999] << std::endl;
+
+	// Shrinks and grows again, copies and swaps
+	vct.resize(1000);
+	printSum(vct);
+	vct.resize(3000000, 1);
+	printSum(vct);
+	vct.insert(vct.begin() + 10, 100000, -1);
+	vct.erase(vct.begin(), vct.begin() + 5);
+	printSum(vct);
+	ft_vct copy(vct.begin(), vct.begin() + 50);
+	copy.swap(vct);
+	printSum(vct);
+	printSum(copy);
+	copy.clear();
+	printSum(copy);
+
+	// Every way of shrinking from the end gives the pages after the last element back
+	ft_vct shrinking(2000000, 7);
+	const long *block = &shrinking[0];
+	for (int i = 0; i < 100000; ++i)
+		shrinking.pop_back();
+	printSum(shrinking);
+	printReleased(shrinking, block);
+	shrinking.erase(shrinking.begin() + 1000, shrinking.end() - 1000);
+	printSum(shrinking);
+	printReleased(shrinking, block);
+	shrinking.resize(500);
+	printSum(shrinking);
+	printReleased(shrinking, block);
+	shrinking.clear();
+	printSum(shrinking);
+	printReleased(shrinking, block);
+	shrinking.push_back(42);
+	printSum(shrinking);
+
+	// Not trivially relocatable, the allocator still works, elements are copied one by one
+	ft_str_vct strings;
+	for (int i = 0; i < 5000; ++i)
+		strings.push_back(std::string(i % 40 + 1, 'a' + i % 26));
+	strings.erase(strings.begin() + 10, strings.end() - 10);
+	std::cout << "size: " << strings.size() << std::endl;
+	for (ft_str_vct::iterator it = strings.begin(); it != strings.end(); ++it)
+		std::cout << "- " << *it << std::endl;
+
+	return (0);
+}
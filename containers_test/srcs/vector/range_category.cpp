@@ -0,0 +1,52 @@
+#include "common.hpp"
+#include <list>
+#include <sstream>
+#include <iterator>
+
+#define TESTED_TYPE int
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE> ft_vct;
+
+int		main(void)
+{
+	int array[] = { 8, 6, 7, 5, 3, 0, 9 };
+	std::list<TESTED_TYPE> lst(array, array + 7);
+
+	// Pointers, bidirectional (list) and single pass (istream) ranges, for the range constructor, assign and insert
+	ft_vct fromPtr(array, array + 7);
+	printSize(fromPtr);
+	ft_vct fromList(lst.begin(), lst.end());
+	printSize(fromList);
+	std::istringstream input("1 2 3 4 5 6 7 8 9 10 11 12");
+	std::istream_iterator<TESTED_TYPE> in(input), end;
+	ft_vct fromStream(in, end);
+	printSize(fromStream);
+
+	fromPtr.assign(lst.rbegin(), lst.rend());
+	printSize(fromPtr);
+	std::istringstream input2("42 43 44");
+	std::istream_iterator<TESTED_TYPE> in2(input2);
+	fromList.assign(in2, end);
+	printSize(fromList);
+
+	fromStream.insert(fromStream.begin() + 3, lst.begin(), lst.end());
+	fromStream.insert(fromStream.end(), array, array + 2);
+	std::istringstream input3("-1 -2 -3 -4 -5 -6 -7 -8 -9 -10 -11 -12 -13 -14 -15 -16 -17");
+	std::istream_iterator<TESTED_TYPE> in3(input3);
+	fromStream.insert(fromStream.begin() + 1, in3, end);
+	printSize(fromStream);
+
+	// From our own iterators (random access), and empty ranges
+	ft_vct copy(fromStream.begin() + 5, fromStream.end() - 5);
+	printSize(copy);
+	copy.insert(copy.begin(), lst.end(), lst.end());
+	copy.assign(array, array);
+	printSize(copy);
+
+	// Iterator distances and arithmetic
+	ft_vct::iterator it = fromStream.begin() + 10;
+	std::cout << "it - begin: " << (it - fromStream.begin()) << " | end - it: " << (fromStream.end() - it)
+			  << " | *(it + 2): " << *(it + 2) << " | it[-1]: " << it[-1] << std::endl;
+
+	return (0);
+}
@@ -0,0 +1,75 @@
+#include "common.hpp"
+
+// Plain data, moved around as bytes
+struct point {
+	int		x;
+	double	y;
+};
+
+std::ostream	&operator<<(std::ostream &o, point const &p) {
+	o << "(" << p.x << ", " << p.y << ")";
+	return o;
+}
+
+// Points to itself: only right if it's copied through it's copy constructor, never as bytes
+class selfRef {
+	public:
+		selfRef(int v = 0) : _value(v), _self(this) { }
+		selfRef(selfRef const &src) : _value(src._value), _self(this) { }
+		selfRef &operator=(selfRef const &src) { this->_value = src._value; return *this; }
+		int		get(void) const { return (this->_self == this ? this->_value : -1); }
+	private:
+		int		_value;
+		selfRef	*_self;
+};
+
+std::ostream	&operator<<(std::ostream &o, selfRef const &s) {
+	o << s.get();
+	return o;
+}
+
+template <typename T>
+void	shuffle(TESTED_NAMESPACE::vector<T> &vct)
+{
+	// Grows several times, then things are inserted / erased in the middle so the rest shifts both ways
+	for (int i = 0; i < 40; ++i)
+		vct.push_back(T());
+	vct.insert(vct.begin() + 5, 3, vct[2]);
+	// A range of our own elements can't be inserted as is (std forbids it), a copy of it can
+	TESTED_NAMESPACE::vector<T> some(vct.begin() + 10, vct.begin() + 14);
+	vct.insert(vct.begin() + 1, some.begin(), some.end());
+	vct.erase(vct.begin() + 3, vct.begin() + 20);
+	vct.erase(vct.begin());
+	vct.insert(vct.begin() + 2, vct.back());
+	vct.resize(60);
+	vct.reserve(200);
+	printSize(vct);
+}
+
+int		main(void)
+{
+	TESTED_NAMESPACE::vector<int> ints;
+	for (int i = 0; i < 10; ++i)
+		ints.push_back(i * i);
+	shuffle(ints);
+
+	TESTED_NAMESPACE::vector<point> points;
+	for (int i = 0; i < 10; ++i)
+	{
+		point p = { i, i / 2.0 };
+		points.push_back(p);
+	}
+	shuffle(points);
+
+	TESTED_NAMESPACE::vector<std::string> strings;
+	for (int i = 0; i < 10; ++i)
+		strings.push_back(std::string(i + 20, 'a' + i)); // Long enough to be on the heap
+	shuffle(strings);
+
+	TESTED_NAMESPACE::vector<selfRef> selves;
+	for (int i = 0; i < 10; ++i)
+		selves.push_back(selfRef(i));
+	shuffle(selves);
+
+	return (0);
+}
@@ -0,0 +1,237 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 17:05 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_SET_HPP
+# define FLAT_SET_HPP
+
+#include "pairs.hpp"
+#include "comparisons.hpp"
+#include "SortedVector.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace ft
+{
+	/* Same interface as ft::set, but stored sorted in a ft::vector (see SortedVector.hpp), so it can replace it with a typedef.
+	   Same deal as ft::flat_map: cheap binary search lookups, single inserts / erases shift the end of the vector */
+	template <class T,
+			  class Compare = std::less<T>,
+			  class Alloc = std::allocator<T>
+			 >
+	class flat_set
+	{
+		public:
+			typedef T key_type;
+			typedef T value_type;
+
+			typedef Compare	key_compare;
+			typedef Compare	value_compare;
+			typedef Alloc	allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef SortedVector<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type> storage_type;
+
+		public:
+			// Values are const in a set, so both are the const_iterator
+			typedef typename storage_type::const_iterator	iterator;
+			typedef typename storage_type::const_iterator	const_iterator;
+
+			typedef ft::reverse_iterator<const_iterator>	reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+		private:
+			allocator_type	_alloc; // Comparator lives in the storage
+			storage_type		_storage;
+
+		public:
+			// Default constructor / empty
+			explicit flat_set(const key_compare& comp = key_compare(),
+							   const allocator_type& alloc = allocator_type())
+							   : _alloc(alloc), _storage(comp, alloc) { }
+
+			// Range constructor, the range is sorted once, not inserted one by one
+			template <class InputIterator>
+			flat_set(InputIterator first, InputIterator last,
+					  const key_compare& comp = key_compare(),
+					  const allocator_type& alloc = allocator_type())
+					  : _alloc(alloc), _storage(comp, alloc)
+			{ this->_storage.insertRange(first, last); }
+
+			// Same but the range is known to be sorted without duplicates, so it's not checked
+			template <class InputIterator>
+			flat_set(ft::sorted_unique_t, InputIterator first, InputIterator last,
+					  const key_compare& comp = key_compare(),
+					  const allocator_type& alloc = allocator_type())
+					  : _alloc(alloc), _storage(comp, alloc)
+			{ this->_storage.insertSortedRange(first, last); }
+
+			// Copy constructor, deep copy
+			flat_set(const flat_set& x) : _alloc(x._alloc), _storage(x._storage) { }
+
+			// Assignation operator
+			flat_set& operator=(const flat_set& x)
+			{
+				this->_alloc = x._alloc;
+				this->_storage = x._storage;
+
+				return (*this);
+			}
+
+			/********** Iterators **********/
+			iterator	begin() const { return (this->_storage.begin()); }
+			iterator	end() const { return (this->_storage.end()); }
+
+			reverse_iterator	rbegin() const { return (reverse_iterator(this->end())); }
+			reverse_iterator	rend() const { return (reverse_iterator(this->begin())); }
+
+			/********** Capacity **********/
+			bool empty() const { return (this->_storage.empty()); }
+			size_type size() const { return (this->_storage.size()); }
+			size_type max_size() const { return (this->_storage.max_size()); }
+
+			/********** Modifiers **********/
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<size_type, bool> ret = this->_storage.insertUnique(val);
+				return (ft::make_pair(this->begin() + ret.first, ret.second));
+			}
+
+			// If val goes right before position, it's inserted there without searching (appending in order is O(1) amortized)
+			iterator insert(iterator position, const value_type& val)
+			{ return (this->begin() + this->_storage.insertUnique(position - this->begin(), val).first); }
+
+			// New values are sorted once then merged with ours in a single pass, O(n + k log k) for k new values
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{ this->_storage.insertRange(first, last); }
+
+			// Same but the range is known to be sorted without duplicates, so only the merge is left
+			template <class InputIterator>
+			void insert(ft::sorted_unique_t, InputIterator first, InputIterator last)
+			{ this->_storage.insertSortedRange(first, last); }
+
+			size_type erase(const key_type& k) { return (this->_storage.remove(k)); }
+
+			// Return the element that followed the erased one(s), which moved to where the erased one was
+			iterator erase(iterator position)
+			{
+				size_type idx = position - this->begin();
+
+				this->_storage.removeAt(idx);
+				return (this->begin() + idx);
+			}
+
+			iterator erase(iterator first, iterator last)
+			{
+				size_type idx = first - this->begin();
+
+				this->_storage.removeRange(idx, last - this->begin());
+				return (this->begin() + idx);
+			}
+
+			void swap(flat_set& x)
+			{
+				allocator_type tmp_alloc = this->_alloc;
+
+				this->_alloc = x._alloc;
+				x._alloc = tmp_alloc;
+
+				this->_storage.swap(x._storage); // Swaps comparators too, no element is copied
+			}
+
+			void clear() { this->_storage.clear(); }
+
+			/********** Observers **********/
+			key_compare key_comp() const { return (this->_storage.key_comp()); }
+
+			value_compare value_comp() const { return (this->_storage.key_comp()); }
+
+			/********** Lookup / Operations **********/
+			// search returns size() when k is not there, so begin() + size() is end()
+			iterator find(const key_type& k) const { return (this->begin() + this->_storage.search(k)); }
+
+			size_type count(const key_type& k) const
+			{
+				if (this->_storage.search(k) != this->size())
+					return (1);
+				return (0);
+			}
+
+			iterator lower_bound(const key_type& k) const { return (this->begin() + this->_storage.lowerBound(k)); }
+
+			iterator upper_bound(const key_type& k) const { return (this->begin() + this->_storage.upperBound(k)); }
+
+			// Values are unique, so the upper bound is right after the lower one if k is there
+			ft::pair<iterator, iterator> equal_range(const key_type& k) const
+			{
+				iterator lower = this->lower_bound(k);
+
+				if (lower != this->end() && !this->key_comp()(k, *lower))
+					return (ft::make_pair(lower, lower + 1));
+				return (ft::make_pair(lower, lower));
+			}
+
+			/********** Allocator **********/
+			allocator_type get_allocator() const { return (this->_alloc); }
+
+			/********** Capacity of the vector (not in std) **********/
+			// Reserve before inserting one by one, so the vector doesn't reallocate along the way
+			void reserve(size_type n) { this->_storage.reserve(n); }
+			size_type capacity() const { return (this->_storage.capacity()); }
+	};
+
+	/********** Non-member overloads **********/
+	template <class T, class Compare, class Alloc>
+	void swap(ft::flat_set<T, Compare, Alloc>& x, ft::flat_set<T, Compare, Alloc>& y)
+	{ x.swap(y); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator==(const ft::flat_set<T, Compare, Alloc>& lhs,
+					const ft::flat_set<T, Compare, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+	}
+
+	template <class T, class Compare, class Alloc>
+	bool operator!=(const ft::flat_set<T, Compare, Alloc>& lhs,
+					const ft::flat_set<T, Compare, Alloc>& rhs)
+	{ return (!(lhs == rhs)); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator<(const ft::flat_set<T, Compare, Alloc>& lhs, const ft::flat_set<T, Compare, Alloc>& rhs)
+	{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator<=(const ft::flat_set<T, Compare, Alloc>& lhs, const ft::flat_set<T, Compare, Alloc>& rhs)
+	{ return (!(rhs < lhs)); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator>(const ft::flat_set<T, Compare, Alloc>& lhs, const ft::flat_set<T, Compare, Alloc>& rhs)
+	{ return (rhs < lhs); }
+
+	template <class T, class Compare, class Alloc>
+	bool operator>=(const ft::flat_set<T, Compare, Alloc>& lhs, const ft::flat_set<T, Compare, Alloc>& rhs)
+	{ return (!(lhs < rhs)); }
+}
+
+#endif
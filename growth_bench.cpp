@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 22:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Pushing ints on a ft::stack, once per growth policy of it's vector (growth_policy.hpp): time, number of
+   reallocations, unused capacity at the end and peak memory (max RSS). Each one runs in it's own process,
+   so that the peak memory is it's own
+   c++ -Wall -Wextra -Werror -std=c++98 -O2 growth_bench.cpp -o growth_bench && ./growth_bench [count] */
+
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "stack.hpp"
+#include "growth_policy.hpp"
+#include "mmap_allocator.hpp"
+
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0);
+}
+
+// To get to the vector under the stack
+template <class Stack>
+struct Exposed : public Stack
+{
+	const typename Stack::container_type& container() const { return (this->c); }
+};
+
+template <class Vector>
+void bench(const char* name, size_t count)
+{
+	pid_t pid = fork();
+
+	if (pid == 0)
+	{
+		Exposed<ft::stack<int, Vector> > s;
+		size_t reallocations = 0;
+		size_t capacity = 0;
+		double start = now();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			s.push(static_cast<int>(i));
+			if (s.container().capacity() != capacity) // Only to count, costs next to nothing
+			{
+				capacity = s.container().capacity();
+				++reallocations;
+			}
+		}
+		double time = now() - start;
+		std::cout << name << time << " ms, " << reallocations << " reallocations, "
+				  << (capacity - s.size()) * 100 / capacity << "% unused";
+		exit((s.top() == static_cast<int>(count - 1)) ? 0 : 1);
+	}
+
+	int status;
+	struct rusage usage;
+	wait4(pid, &status, 0, &usage);
+	std::cout << ", peak " << usage.ru_maxrss / 1024 << " MiB" << ((status == 0) ? "" : " (WRONG)") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t count = (argc > 1) ? atoi(argv[1]) : 100000000;
+
+	std::cout << count << " ints (" << count * sizeof(int) / (1024 * 1024) << " MiB)" << std::endl;
+	bench<ft::vector<int, std::allocator<int>, ft::doubling_growth> >("doubling:                 ", count);
+	bench<ft::vector<int, std::allocator<int>, ft::one_and_half_growth> >("x1.5:                     ", count);
+	bench<ft::vector<int, std::allocator<int>, ft::page_growth> >("page rounded:             ", count);
+	bench<ft::vector<int, std::allocator<int>, ft::capped_growth<> > >("capped 64 MiB:            ", count);
+	bench<ft::vector<int, ft::mmap_allocator<int>, ft::capped_growth<> > >("capped 64 MiB, mmap:      ", count);
+	return (0);
+}
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 21:50 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GROWTH_POLICY_HPP
+# define GROWTH_POLICY_HPP
+
+#include <cstddef>
+#include <unistd.h> // sysconf
+
+namespace ft
+{
+	/* How much a full vector grows (see vector's 3rd template parameter). A policy only needs
+	   static size_t next(size_t capacity, size_t required, size_t elementSize)
+	   giving the new capacity of a vector of capacity that needs room for required values (more than capacity),
+	   elementSize being sizeof(value_type). Anything less than required is taken as required */
+
+	// x2, amortized O(1) push_back, but up to half of the memory is unused right after growing
+	struct doubling_growth
+	{
+		static size_t next(size_t capacity, size_t required, size_t elementSize)
+		{
+			(void)elementSize;
+			return ((capacity * 2 > required) ? capacity * 2 : required);
+		}
+	};
+
+	// x1.5, a few more reallocations but at most a third unused, and old blocks add up to enough for a new one
+	// sooner, so the allocator can reuse them
+	struct one_and_half_growth
+	{
+		static size_t next(size_t capacity, size_t required, size_t elementSize)
+		{
+			(void)elementSize;
+			return ((capacity + capacity / 2 > required) ? capacity + capacity / 2 : required);
+		}
+	};
+
+	/* Doubling, rounded up to whole pages: the first block is a page worth of values instead of one (no 1, 2, 4...
+	   reallocations for small values), and the last page of a block is never half used */
+	struct page_growth
+	{
+		static size_t pageSize()
+		{
+			static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+			return (size);
+		}
+
+		static size_t next(size_t capacity, size_t required, size_t elementSize)
+		{
+			size_t wanted = doubling_growth::next(capacity, required, elementSize);
+			size_t bytes = (wanted * elementSize + pageSize() - 1) / pageSize() * pageSize();
+
+			return (bytes / elementSize);
+		}
+	};
+
+	/* Doubling until a step would be more than MaxStep bytes, then MaxStep bytes at a time: never more than MaxStep
+	   unused, but past that point each step copies everything, O(n^2 / MaxStep) copies in total.
+	   Made for huge vectors with ft::mmap_allocator, which grows without copying */
+	template <size_t MaxStep = 64 * 1024 * 1024>
+	struct capped_growth
+	{
+		static size_t next(size_t capacity, size_t required, size_t elementSize)
+		{
+			size_t maxStep = (MaxStep / elementSize > 0) ? MaxStep / elementSize : 1;
+			size_t step = (capacity < maxStep) ? capacity : maxStep;
+
+			return ((capacity + step > required) ? capacity + step : required);
+		}
+	};
+
+	/* Policy of every vector<T> not given one, specialize it to change it for a type without naming the vector,
+	   eg. for the vector under a ft::stack<MyType>:
+	   namespace ft { template <> struct default_growth<MyType> { typedef ft::page_growth type; }; } */
+	template <class T>
+	struct default_growth { typedef doubling_growth type; };
+
+}
+
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+#include <string>
+#include <cstddef>
+
+namespace ft
+{
+	/* std::hash only exists since C++11, so here is ours for the unordered containers.
+	   Hashes don't have to be well mixed, the hash table mixes them again before using them */
+	template <class T>
+	struct hash; // Not defined for types without a specialization, use your own Hash for those
+
+	// Integers are their own hash
+	template <class T>
+	struct integral_hash
+	{
+		typedef T		argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(T x) const { return (static_cast<size_t>(x)); }
+	};
+
+	template <>
+	struct hash<bool> : public integral_hash<bool> { };
+
+	template <>
+	struct hash<char> : public integral_hash<char> { };
+
+	template <>
+	struct hash<wchar_t> : public integral_hash<wchar_t> { };
+
+	template <>
+	struct hash<signed char> : public integral_hash<signed char> { };
+
+	template <>
+	struct hash<short int> : public integral_hash<short int> { };
+
+	template <>
+	struct hash<int> : public integral_hash<int> { };
+
+	template <>
+	struct hash<long int> : public integral_hash<long int> { };
+
+	template <>
+	struct hash<long long int> : public integral_hash<long long int> { };
+
+	template <>
+	struct hash<unsigned char> : public integral_hash<unsigned char> { };
+
+	template <>
+	struct hash<unsigned short int> : public integral_hash<unsigned short int> { };
+
+	template <>
+	struct hash<unsigned int> : public integral_hash<unsigned int> { };
+
+	template <>
+	struct hash<unsigned long int> : public integral_hash<unsigned long int> { };
+
+	template <>
+	struct hash<unsigned long long int> : public integral_hash<unsigned long long int> { };
+
+	// Pointers hash their address
+	template <class T>
+	struct hash<T*>
+	{
+		typedef T*		argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(T* p) const { return (reinterpret_cast<size_t>(p)); }
+	};
+
+	// FNV-1a over the bytes, simple and good enough for keys like names
+	inline size_t hash_bytes(const void* ptr, size_t len)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(ptr);
+		size_t h = static_cast<size_t>(2166136261u);
+
+		for (size_t i = 0; i < len; ++i)
+		{
+			h ^= bytes[i];
+			h *= static_cast<size_t>(16777619u);
+		}
+		return (h);
+	}
+
+	template <>
+	struct hash<std::string>
+	{
+		typedef std::string	argument_type;
+		typedef size_t		result_type;
+
+		size_t operator()(const std::string& s) const { return (ft::hash_bytes(s.data(), s.size())); }
+	};
+
+	// 0.0 and -0.0 are equal so they must have the same hash, the bytes differ though
+	template <>
+	struct hash<float>
+	{
+		typedef float	argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(float x) const { return ((x == 0.0f) ? 0 : ft::hash_bytes(&x, sizeof(x))); }
+	};
+
+	template <>
+	struct hash<double>
+	{
+		typedef double	argument_type;
+		typedef size_t	result_type;
+
+		size_t operator()(double x) const { return ((x == 0.0) ? 0 : ft::hash_bytes(&x, sizeof(x))); }
+	};
+
+}
+
+#endif
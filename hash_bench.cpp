@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* ft::map vs ft::unordered_map on point lookups, same loop as main.cpp (operator[] on random keys) plus find / count
+   c++ -Wall -Wextra -Werror -std=c++98 -O2 hash_bench.cpp -o hash_bench && ./hash_bench [count] [seed] */
+
+#include <iostream>
+#include <ctime>
+#include <stdlib.h>
+
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+static double elapsed(clock_t start) { return (static_cast<double>(clock() - start) * 1000 / CLOCKS_PER_SEC); }
+
+template <class Map>
+void bench(const char* name, const ft::vector<int>& keys, const ft::vector<int>& lookups)
+{
+	Map m;
+	long sum = 0;
+	clock_t start;
+
+	std::cout << name << std::endl;
+
+	start = clock();
+	for (size_t i = 0; i < keys.size(); ++i)
+		m.insert(ft::make_pair(keys[i], static_cast<int>(i)));
+	std::cout << "  insert:     " << elapsed(start) << " ms (" << m.size() << " keys)" << std::endl;
+
+	start = clock();
+	for (size_t i = 0; i < lookups.size(); ++i)
+	{
+		typename Map::const_iterator it = m.find(lookups[i]);
+		if (it != m.end())
+			sum += it->second;
+	}
+	std::cout << "  find:       " << elapsed(start) << " ms" << std::endl;
+
+	start = clock();
+	for (size_t i = 0; i < lookups.size(); ++i)
+		sum += m.count(lookups[i]);
+	std::cout << "  count:      " << elapsed(start) << " ms" << std::endl;
+
+	// Inserts the misses, like main.cpp does
+	start = clock();
+	for (size_t i = 0; i < lookups.size(); ++i)
+		sum += m[lookups[i]];
+	std::cout << "  operator[]: " << elapsed(start) << " ms (" << m.size() << " keys)" << std::endl;
+
+	start = clock();
+	for (size_t i = 0; i < lookups.size(); ++i)
+		m.erase(lookups[i]);
+	std::cout << "  erase:      " << elapsed(start) << " ms (" << m.size() << " keys left)" << std::endl;
+
+	// So the compiler can't drop the lookups
+	std::cout << "  checksum:   " << sum << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t count = (argc > 1) ? atoi(argv[1]) : 1000000;
+	int seed = (argc > 2) ? atoi(argv[2]) : 42;
+	ft::vector<int> keys;
+	ft::vector<int> lookups;
+
+	srand(seed);
+	for (size_t i = 0; i < count; ++i)
+		keys.push_back(rand());
+	for (size_t i = 0; i < count; ++i)
+		lookups.push_back((i % 2) ? keys[rand() % count] : rand()); // Half hits, half (mostly) misses
+
+	bench<ft::map<int, int> >("ft::map (red-black tree)", keys, lookups);
+	bench<ft::unordered_map<int, int> >("ft::unordered_map (open addressing)", keys, lookups);
+	return (0);
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 20:15 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_TRIVIALLY_RELOCATABLE_HPP
+# define IS_TRIVIALLY_RELOCATABLE_HPP
+
+#include "is_integral.hpp"
+#include "utils.hpp"
+#include "pairs.hpp"
+
+namespace ft
+{
+	/* A type is trivially relocatable if moving it's bytes somewhere else (memcpy / memmove) and forgetting the old
+	   ones is the same as copy constructing it there and destroying the original. True for anything without a
+	   constructor / destructor doing something (no pointer to itself, no registration...), so containers can move
+	   a whole array at once instead of one element at a time (see vector).
+	   C++98 can't tell that by itself, so it's only known for integers, floating points and pointers,
+	   anything else has to opt in, eg.
+	   namespace ft { template <> struct is_trivially_relocatable<MyPod> : public ft::true_type { }; } */
+	template <class T>
+	struct is_trivially_relocatable : public ft::choose<ft::is_integral<T>::value, ft::true_type, ft::false_type>::type { };
+
+	// A const object is moved the same way
+	template <class T>
+	struct is_trivially_relocatable<const T> : public is_trivially_relocatable<T> { };
+
+	template <>
+	struct is_trivially_relocatable<float> : public true_type { };
+
+	template <>
+	struct is_trivially_relocatable<double> : public true_type { };
+
+	template <>
+	struct is_trivially_relocatable<long double> : public true_type { };
+
+	template <class T>
+	struct is_trivially_relocatable<T*> : public true_type { };
+
+	// A pair is if both of it's members are
+	template <class T1, class T2>
+	struct is_trivially_relocatable<ft::pair<T1, T2> >
+	: public ft::choose<is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value, ft::true_type, ft::false_type>::type { };
+
+}
+
+#endif
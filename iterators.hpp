@@ -17,6 +17,7 @@
 #include "enable_if.hpp"
 
 #include <iostream>
+#include <iterator>
 #include <cstddef>
 
 namespace ft
@@ -80,6 +81,88 @@ namespace ft
 	};
 
 
+	/* std iterators (eg. std::vector<int>::iterator) use std tags, which our tags don't inherit from,
+	   so translate them to be able to dispatch on the category of any iterator */
+	template <class Category>
+	struct to_ft_category { typedef Category type; };
+
+	template <>
+	struct to_ft_category<std::input_iterator_tag> { typedef ft::input_iterator_tag type; };
+
+	template <>
+	struct to_ft_category<std::output_iterator_tag> { typedef ft::output_iterator_tag type; };
+
+	template <>
+	struct to_ft_category<std::forward_iterator_tag> { typedef ft::forward_iterator_tag type; };
+
+	template <>
+	struct to_ft_category<std::bidirectional_iterator_tag> { typedef ft::bidirectional_iterator_tag type; };
+
+	template <>
+	struct to_ft_category<std::random_access_iterator_tag> { typedef ft::random_access_iterator_tag type; };
+
+	/* Returns an (empty) tag object, used to pick an overload at compile time, eg.
+	   foo(first, last, ft::iterator_category_of(first)) calls foo(It, It, ft::forward_iterator_tag) for forward iterators and better */
+	template <class Iterator>
+	typename ft::to_ft_category<typename ft::iterator_traits<Iterator>::iterator_category>::type
+	iterator_category_of(const Iterator&)
+	{ return (typename ft::to_ft_category<typename ft::iterator_traits<Iterator>::iterator_category>::type()); }
+
+
+	/*******************************************************
+	 *                 Distance / Advance                  *
+	 *******************************************************/
+
+	/* Same as std::distance / std::advance, which only know std tags. The overload is picked with the category at
+	   compile time: random access iterators jump in O(1), the others can only step one by one */
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last, ft::input_iterator_tag)
+	{
+		typename ft::iterator_traits<InputIterator>::difference_type n = 0;
+
+		for (; first != last; ++first)
+			++n;
+		return (n);
+	}
+
+	template <class RandomAccessIterator>
+	typename ft::iterator_traits<RandomAccessIterator>::difference_type
+	distance(RandomAccessIterator first, RandomAccessIterator last, ft::random_access_iterator_tag)
+	{ return (last - first); }
+
+	// Careful, a single pass iterator is used up once counted
+	template <class InputIterator>
+	typename ft::iterator_traits<InputIterator>::difference_type
+	distance(InputIterator first, InputIterator last)
+	{ return (ft::distance(first, last, ft::iterator_category_of(first))); }
+
+	template <class InputIterator, class Distance>
+	void advance(InputIterator& it, Distance n, ft::input_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+	}
+
+	// Only these can go backward (n < 0)
+	template <class BidirectionalIterator, class Distance>
+	void advance(BidirectionalIterator& it, Distance n, ft::bidirectional_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+		for (; n < 0; ++n)
+			--it;
+	}
+
+	template <class RandomAccessIterator, class Distance>
+	void advance(RandomAccessIterator& it, Distance n, ft::random_access_iterator_tag)
+	{ it += n; }
+
+	template <class InputIterator, class Distance>
+	void advance(InputIterator& it, Distance n)
+	{ ft::advance(it, n, ft::iterator_category_of(it)); }
+
+
 	/*******************************************************
 	 *                  Reverse iterator                   *
 	 *******************************************************/
@@ -35,6 +35,15 @@ struct Buffer
 	char buff[BUFFER_SIZE];
 };
 
+#ifndef TEST_STD
+// Plain bytes, so vector can move Buffers with memcpy when it grows
+namespace ft
+{
+	template <>
+	struct is_trivially_relocatable<Buffer> : public ft::true_type { };
+}
+#endif
+
 
 #define COUNT (MAX_RAM / (int)sizeof(Buffer))
 
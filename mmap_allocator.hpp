@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 21:05 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MMAP_ALLOCATOR_HPP
+# define MMAP_ALLOCATOR_HPP
+
+#include "is_integral.hpp"
+
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(MAP_ANON) && !defined(MAP_ANONYMOUS)
+# define MAP_ANONYMOUS MAP_ANON // macOS
+#endif
+
+namespace ft
+{
+	/* Allocator giving every allocation it's own anonymous mapping, made for huge vectors (gigabytes).
+	   Besides the usual allocator interface it can:
+	   - reallocate: grow / shrink a block keeping it's bytes, with mremap on Linux the kernel just moves the pages
+	     (no copy, and never the old and the new block at once, so growing doesn't need twice the memory).
+	     Elsewhere it's a new mapping and a memcpy. Only for trivially relocatable types (see is_trivially_relocatable.hpp)
+	   - release: give the whole pages of a part we don't use anymore back to the system (MADV_DONTNEED),
+	     the block keeps it's size and the pages come back (zeroed) once touched again
+	   Blocks of hugePageSize or more are advised to use transparent huge pages (MADV_HUGEPAGE) when the system has them,
+	   define FT_MMAP_NO_HUGEPAGE before including to not do it.
+	   Rounding to pages makes small blocks expensive, use it for big ones only */
+	template <class T>
+	class mmap_allocator
+	{
+		public:
+			typedef T				value_type;
+			typedef T*				pointer;
+			typedef const T*		const_pointer;
+			typedef T&				reference;
+			typedef const T&		const_reference;
+			typedef size_t			size_type;
+			typedef ptrdiff_t		difference_type;
+
+			template <class U>
+			struct rebind { typedef mmap_allocator<U> other; };
+
+			static const size_type hugePageSize = 2 * 1024 * 1024;
+
+		private:
+			static size_type pageSize()
+			{
+				static const size_type size = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+				return (size);
+			}
+
+			// Mappings are whole pages
+			static size_type mappedBytes(size_type n) { return ((n * sizeof(T) + pageSize() - 1) / pageSize() * pageSize()); }
+
+			static void adviseHugePages(void* addr, size_type bytes)
+			{
+			#if defined(MADV_HUGEPAGE) && !defined(FT_MMAP_NO_HUGEPAGE)
+				if (bytes >= hugePageSize)
+					madvise(addr, bytes, MADV_HUGEPAGE); // Only advice, nothing to do if it fails
+			#else
+				(void)addr;
+				(void)bytes;
+			#endif
+			}
+
+		public:
+			mmap_allocator() { }
+			mmap_allocator(const mmap_allocator&) { }
+			template <class U>
+			mmap_allocator(const mmap_allocator<U>&) { }
+			~mmap_allocator() { }
+
+			pointer address(reference x) const { return (&x); }
+			const_pointer address(const_reference x) const { return (&x); }
+
+			pointer allocate(size_type n, const void* hint = 0)
+			{
+				(void)hint;
+				if (n == 0)
+					return (NULL);
+				if (n > this->max_size())
+					throw (std::bad_alloc());
+
+				size_type bytes = mappedBytes(n);
+				void* addr = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (addr == MAP_FAILED)
+					throw (std::bad_alloc());
+				adviseHugePages(addr, bytes);
+				return (static_cast<pointer>(addr));
+			}
+
+			void deallocate(pointer p, size_type n)
+			{
+				if (p != NULL)
+					munmap(static_cast<void*>(p), mappedBytes(n));
+			}
+
+			/* Block p of n values now holds newN values, the first min(n, newN) are kept as bytes.
+			   Returns where the block is now (p is not valid anymore), throws std::bad_alloc if it can't (p is still valid then) */
+			pointer reallocate(pointer p, size_type n, size_type newN)
+			{
+				if (p == NULL)
+					return (this->allocate(newN));
+				if (newN == 0)
+				{
+					this->deallocate(p, n);
+					return (NULL);
+				}
+				if (newN > this->max_size())
+					throw (std::bad_alloc());
+
+				size_type bytes = mappedBytes(n);
+				size_type newBytes = mappedBytes(newN);
+				if (bytes == newBytes)
+					return (p);
+
+			#ifdef MREMAP_MAYMOVE
+				void* addr = mremap(static_cast<void*>(p), bytes, newBytes, MREMAP_MAYMOVE);
+				if (addr == MAP_FAILED)
+					throw (std::bad_alloc());
+				adviseHugePages(addr, newBytes);
+				return (static_cast<pointer>(addr));
+			#else
+				pointer newP = this->allocate(newN);
+				std::memcpy(static_cast<void*>(newP), static_cast<const void*>(p), ((bytes < newBytes) ? bytes : newBytes));
+				this->deallocate(p, n);
+				return (newP);
+			#endif
+			}
+
+			// Values [used, n) of block p are not needed anymore, give back the pages only they were on, the block keeps it's size
+			void release(pointer p, size_type used, size_type n)
+			{
+				if (p == NULL)
+					return;
+
+				char* begin = reinterpret_cast<char*>(p);
+				size_type from = (used * sizeof(T) + pageSize() - 1) / pageSize() * pageSize();
+				size_type to = mappedBytes(n);
+				if (from < to)
+					madvise(static_cast<void*>(begin + from), to - from, MADV_DONTNEED);
+			}
+
+			size_type max_size() const { return (static_cast<size_type>(-1) / sizeof(T)); }
+
+			void construct(pointer p, const_reference val) { new (static_cast<void*>(p)) T(val); }
+
+			void destroy(pointer p) { p->~T(); }
+	};
+
+	// Blocks don't depend on the allocator, any one can free them
+	template <class T1, class T2>
+	bool operator==(const mmap_allocator<T1>&, const mmap_allocator<T2>&) { return (true); }
+
+	template <class T1, class T2>
+	bool operator!=(const mmap_allocator<T1>&, const mmap_allocator<T2>&) { return (false); }
+
+	/* Tells containers an allocator has reallocate / release like mmap_allocator, so that they can grow
+	   without copying. Specialize it for your own allocators with the same members */
+	template <class Allocator>
+	struct is_remappable_allocator : public ft::false_type { };
+
+	template <class T>
+	struct is_remappable_allocator<mmap_allocator<T> > : public ft::true_type { };
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 21:05 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Growing a ft::vector of main.cpp's 4 KB Buffers by push_back, std::allocator vs ft::mmap_allocator.
+   Each one runs in it's own process, so that the peak memory (max RSS) is it's own
+   c++ -Wall -Wextra -Werror -std=c++98 -O2 mmap_bench.cpp -o mmap_bench && ./mmap_bench [MiB] */
+
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "vector.hpp"
+#include "mmap_allocator.hpp"
+
+struct Buffer
+{
+	int idx;
+	char buff[4096];
+};
+
+namespace ft
+{
+	template <>
+	struct is_trivially_relocatable<Buffer> : public ft::true_type { };
+}
+
+static double now()
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0);
+}
+
+template <class Vector>
+void bench(const char* name, size_t count)
+{
+	pid_t pid = fork();
+
+	if (pid == 0)
+	{
+		Vector v;
+		double start = now();
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			v.push_back(Buffer());
+			v.back().idx = static_cast<int>(i);
+		}
+		std::cout << name << v.size() * sizeof(Buffer) / (1024 * 1024) << " MiB in " << now() - start << " ms";
+		exit(v[count / 2].idx == static_cast<int>(count / 2) ? 0 : 1);
+	}
+
+	int status;
+	struct rusage usage;
+	wait4(pid, &status, 0, &usage);
+	std::cout << ", peak " << usage.ru_maxrss / 1024 << " MiB" << ((status == 0) ? "" : " (WRONG)") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	size_t mib = (argc > 1) ? atoi(argv[1]) : 1024;
+	size_t count = mib * 1024 * 1024 / sizeof(Buffer);
+
+	bench<ft::vector<Buffer> >("std::allocator:     ", count);
+	bench<ft::vector<Buffer, ft::mmap_allocator<Buffer> > >("ft::mmap_allocator: ", count);
+	return (0);
+}
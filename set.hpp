@@ -43,7 +43,9 @@ namespace ft
 			typedef typename allocator_type::const_pointer		const_pointer;
 		
 		private:
-			typedef RedBlackTree<value_type, value_compare, allocator_type> tree_type;
+			// Values are their own keys
+			typedef RedBlackTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type> tree_type;
+			typedef typename tree_type::node_pointer node_pointer;
 
 		public:
 			// Since in a set all values are const, simply use the const_iterator as iterator, smort
@@ -56,54 +58,40 @@ namespace ft
 			typedef ptrdiff_t	difference_type;
 			typedef size_t		size_type;
 
+			typedef typename tree_type::pool_stats	pool_stats_type;
+
 		private:
-			value_compare	_comp;
-			allocator_type	_alloc;
+			allocator_type	_alloc; // Comparator lives in the tree
 			tree_type		_tree;
 
-			// Pretty easy but I'm smartn't so this won't have my monkey brain
-			bool isInf(const key_type& lhs, const key_type& rhs) const
-			{ return (this->_comp(lhs, rhs)); }
-
-			bool isInfOrEqual(const key_type& lhs, const key_type& rhs) const
-			{ return (this->isInf(lhs, rhs) || this->isEq(lhs, rhs)); }
-
-			bool isSup(const key_type& lhs, const key_type& rhs) const
-			{ return (!this->isInf(lhs, rhs) && !this->isEq(lhs, rhs)); }
-
-			bool isSupOrEqual(const key_type& lhs, const key_type& rhs) const
-			{ return (this->isSup(lhs, rhs) || this->isEq(lhs, rhs)); }
-
-			bool isEq(const key_type& lhs, const key_type& rhs) const
-			{ return (!this->_comp(lhs, rhs) && !this->_comp(rhs, lhs)); }
-
 		public:
 			// Default constructor / empty
 			explicit set(const key_compare& comp = key_compare(),
 			             const allocator_type& alloc = allocator_type())
-						 : _comp(comp), _alloc(alloc), _tree() { }
+						 : _alloc(alloc), _tree(comp, alloc) { }
 
 			// Range constructor
 			template <class InputIterator>
 			set(InputIterator first, InputIterator last,
 			     const key_compare& comp = key_compare(),
 				 const allocator_type& alloc = allocator_type())
-				 : _comp(comp), _alloc(alloc), _tree()
-			{
-				while (first != last)
-				{
-					this->_tree.insert(*first);
-					++first;
-				}
-			}
+				 : _alloc(alloc), _tree(comp, alloc)
+			{ this->_tree.insertRange(first, last); }
+
+			// Same but the range is known to be sorted without duplicates, so it's not checked
+			template <class InputIterator>
+			set(ft::sorted_unique_t, InputIterator first, InputIterator last,
+			     const key_compare& comp = key_compare(),
+				 const allocator_type& alloc = allocator_type())
+				 : _alloc(alloc), _tree(comp, alloc)
+			{ this->_tree.insertSortedRange(first, last); }
 
 			// Copy constructor, deep copy tree
-			set(const set& x) : _comp(x._comp), _alloc(x._alloc), _tree(x._tree) { }
+			set(const set& x) : _alloc(x._alloc), _tree(x._tree) { }
 
 			// Assignation operator
 			set& operator=(const set& x)
 			{
-				this->_comp = x._comp;
 				this->_alloc = x._alloc;
 				this->_tree = x._tree;
 				
@@ -124,91 +112,81 @@ namespace ft
 			const_reverse_iterator	rend() const { return (this->_tree.rend()); }
 
 			/********** Capacity **********/
-			bool empty() const { return (this->_tree.size() == 0); }
+			bool empty() const { return (this->_tree.empty()); }
 			size_type size() const { return (this->_tree.size()); }
 			size_type max_size() const { return (this->_tree.max_size()); }
 
 			/********** Modifiers **********/
 
-			// tree.insert returns true if added, false if already present
-			// So just add the value anyway, and then search for it since map has unique keys
+			// tree.insertUnique returns the node holding val, and true if added, false if already present
 			ft::pair<iterator, bool> insert(const value_type& val)
 			{
-				bool inserted = this->_tree.insert(val);
-				return (ft::make_pair(iterator(this->_tree.search(val)), inserted));
+				ft::pair<node_pointer, bool> ret = this->_tree.insertUnique(val);
+				return (ft::make_pair(iterator(ret.first), ret.second));
 			}
 
-			// Should use position for optimization, but meh
+			// position is a hint, if val goes right before or after it, it's linked there without searching from the root
 			iterator insert(iterator position, const value_type& val)
-			{
-				(void) position;
-				
-				return (this->insert(val).first);
-			}
+			{ return (iterator(this->_tree.insertUnique(position.getNode(), val).first)); }
 
+			/* If we are empty and the range is sorted without duplicates, the tree is built directly in O(n),
+			   otherwise every value is hinted at end(), so that sorted ranges still cost amortized constant time each */
 			template <class InputIterator>
  			void insert(InputIterator first, InputIterator last)
-			{
-				while (first != last)
-					this->_tree.insert(*first++);
-			}
+			{ this->_tree.insertRange(first, last); }
 
-			
-			size_type erase(const key_type& k)
-			{
-				size_type return_val = 0;
+			// Same but the range is known to be sorted without duplicates, so it's not checked
+			template <class InputIterator>
+ 			void insert(ft::sorted_unique_t, InputIterator first, InputIterator last)
+			{ this->_tree.insertSortedRange(first, last); }
+
+			/* Same result as insert(first, last) (out of equal keys the first one is kept, and ours if we have it),
+			   made for big unsorted ranges: they are sorted once then the tree is built balanced in O(n), instead of
+			   n rebalancing inserts. Single pass iterators are inserted one by one.
+			   The sort runs on threads worker threads, 0 for one per core (link with -pthread). Defining
+			   FT_NO_PARALLEL_BULK_INSERT before including takes the threads out: no threads parameter, one sort, no pthread */
+			#ifndef FT_NO_PARALLEL_BULK_INSERT
+			template <class InputIterator>
+			void bulk_insert(InputIterator first, InputIterator last, size_type threads = 0)
+			{ this->_tree.bulkLoad(first, last, threads); }
+			#else
+			template <class InputIterator>
+			void bulk_insert(InputIterator first, InputIterator last)
+			{ this->_tree.bulkLoad(first, last, 1); }
+			#endif
 
-				if (this->_tree.search(k) != NULL)
-				{
-					this->_tree.remove(k);
-					return_val = 1;
-				}
-				return (return_val);
-			}
 			
-			void erase(iterator position)
-			{
-				this->_tree.remove(*position);
-			}
+			size_type erase(const key_type& k) { return (this->_tree.remove(k)); }
+			
+			// The node is unlinked directly, no search. Returns the element that followed the erased one
+			iterator erase(iterator position) { return (iterator(this->_tree.remove(position.getNode()))); }
 
-			// Since iterator being erased is invalidated on remove, first save next node
-			void erase(iterator first, iterator last)
-			{
-				iterator tmp;
-				while (first != last)
-				{
-					tmp = first;
-					++first;
-					this->_tree.remove(*tmp);
-				}
-			}
+			// Same, no search at all, O(k + log n) for k elements. Returns last
+			iterator erase(iterator first, iterator last)
+			{ return (iterator(this->_tree.removeRange(first.getNode(), last.getNode()))); }
 
 			void swap(set& x)
 			{
-				key_compare tmp_comp = this->_comp;
 				allocator_type tmp_alloc = this->_alloc;
 
-				this->_comp = x._comp;
 				this->_alloc = x._alloc;
-
-				x._comp = tmp_comp;
 				x._alloc = tmp_alloc;
 
-				this->_tree.swap(x._tree);
+				this->_tree.swap(x._tree); // Swaps comparators too
 			}
 
 			void clear() { this->_tree.clear(); }
 			
 			/********** Observers **********/
-			key_compare key_comp() const { return (this->_comp); }
+			key_compare key_comp() const { return (this->_tree.key_comp()); }
 
 			// Will create a copy since it's not returned by reference
-			value_compare value_comp() const { return (this->_comp); }
+			value_compare value_comp() const { return (this->_tree.key_comp()); }
 
 			/********** Lookup / Operations **********/
 			iterator find(const key_type& k)
 			{
-				typename tree_type::node_pointer value = this->_tree.search(k);
+				node_pointer value = this->_tree.search(k);
 				if (value == NULL)
 					return (this->end());
 				
@@ -217,7 +195,7 @@ namespace ft
 
 			const_iterator find(const key_type& k) const
 			{
-				typename tree_type::node_pointer value = this->_tree.search(k);
+				node_pointer value = this->_tree.search(k);
 				if (value == NULL)
 					return (this->end());
 				
@@ -234,73 +212,114 @@ namespace ft
 
 			// Returns an iterator pointing to the first element in the container whose key 
 			// is not considered to go before k (i.e., either it is equivalent or goes after).
-			iterator lower_bound(const key_type& k)
-			{
-				typename tree_type::node_pointer curr = this->_tree.first();
-				
-				while (curr != NULL && this->isInf(curr->data, k))
-					curr = tree_type::inorderSuccessor(curr);
+			iterator lower_bound(const key_type& k) { return (iterator(this->_tree.lowerBound(k))); }
+			const_iterator lower_bound(const key_type& k) const { return (const_iterator(this->_tree.lowerBound(k))); }
 
-				if (curr == NULL || curr == this->_tree.getDummyEnd())
-					return (this->end());
+			// Same but first element whose key goes after k
+			iterator upper_bound(const key_type& k) { return (iterator(this->_tree.upperBound(k))); }
+			const_iterator upper_bound(const key_type& k) const { return (const_iterator(this->_tree.upperBound(k))); }
 
-				return (iterator(curr));
+			// Returns a range that includes all elements with a key == k
+			// Since keys are unique, the range is at most 1 long
+			/* The function returns a pair, whose member pair::first is the lower bound of the range (the same as lower_bound),
+			   and pair::second is the upper bound (the same as upper_bound). */
+			ft::pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				ft::pair<node_pointer, node_pointer> range = this->_tree.equalRange(k);
+				return (ft::make_pair(iterator(range.first), iterator(range.second)));
 			}
 
-			const_iterator lower_bound(const key_type& k) const
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
 			{
+				ft::pair<node_pointer, node_pointer> range = this->_tree.equalRange(k);
+				return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+			}
+	
+			/********** Allocator **********/
+			// Will copy since it doesn't return by reference
+			allocator_type get_allocator() const { return (this->_alloc); }
 
-				typename tree_type::node_pointer curr = this->_tree.first();
-				
-				while (curr != NULL && this->isInf(curr->data, k))
-					curr = tree_type::inorderSuccessor(curr);
+			/********** Node pool (not in std) **********/
+			// Nodes come from slabs owned by the set and erased ones are recycled, these counters help tuning it
+			pool_stats_type pool_stats() const { return (this->_tree.poolStats()); }
 
-				if (curr == NULL || curr == this->_tree.getDummyEnd())
-					return (this->end());
+			// By default clear() gives the slabs back, keep them if the set gets refilled right after
+			void keep_nodes_on_clear(bool keep) { this->_tree.keepNodesOnClear(keep); }
+
+			/********** Order statistics (not in std) **********/
+			// O(log n) when FT_ORDER_STATISTICS is defined before including, they walk the set in order otherwise
+
+			// n-th smallest element (from 0), end() if n >= size()
+			const_iterator nth(size_type n) const { return (const_iterator(this->_tree.select(n))); }
+
+			// Number of elements whose key goes before k
+			size_type rank(const key_type& k) const { return (this->_tree.rank(k)); }
 
-				return (const_iterator(curr));
+			// Same as std::distance(first, last), without walking from first to last
+			difference_type distance(const_iterator first, const_iterator last) const
+			{
+				return (static_cast<difference_type>(this->_tree.indexOf(last.getNode()))
+						- static_cast<difference_type>(this->_tree.indexOf(first.getNode())));
 			}
 
-			iterator upper_bound(const key_type& k)
+			/********** Split / append (not in std) **********/
+			// Nodes are moved from one set to the other, never copied. Sets that gave nodes to each other share their node pool
+
+			/* Everything from k (included) goes to out, whatever out held before is destroyed (out gets our comparator).
+			   O(log n) to cut the tree, plus counting the smaller side without FT_ORDER_STATISTICS (sizes stay O(1)) */
+			void split_off(const key_type& k, set& out)
 			{
-				typename tree_type::node_pointer curr = this->_tree.first();
-				
-				while (curr != NULL && !this->isInf(k, curr->data))
-					curr = tree_type::inorderSuccessor(curr);
+				this->_tree.split(k, out._tree);
+			}
 
-				if (curr == NULL || curr == this->_tree.getDummyEnd())
-					return (this->end());
+			/* Move every value of x to this set. O(log n) when all keys of x go after ours (or all before), x is left empty.
+			   Otherwise it's a merge (see below): keys we already had stay in x, like with merge */
+			void append(set& x)
+			{
+				if (this == &x || this->_tree.join(x._tree))
+					return;
+				this->_tree.merge(x._tree);
+			}
+
+			/********** Set algebra (not in std) **********/
+			// Both sets are read in order at once instead of searching one in the other, the result is built balanced
+
+			// Every key of both, with our value for keys in both. O(n + m)
+			set set_union(const set& x) const
+			{
+				set ret(this->key_comp(), this->_alloc);
 
-				return (iterator(curr));
+				this->_tree.setUnion(x._tree, ret._tree);
+				return (ret);
 			}
 
-			const_iterator upper_bound(const key_type& k) const
+			// Our values whose key is in x. O(n + m), or O(small * log big) if one of them is much smaller
+			set set_intersection(const set& x) const
 			{
-				
-				typename tree_type::node_pointer curr = this->_tree.first();
-				
-				while (curr != NULL && !this->isInf(k, curr->data))
-					curr = tree_type::inorderSuccessor(curr);
+				set ret(this->key_comp(), this->_alloc);
 
-				if (curr == NULL || curr == this->_tree.getDummyEnd())
-					return (this->end());
+				this->_tree.setIntersection(x._tree, ret._tree);
+				return (ret);
+			}
 
-				return (const_iterator(curr));
+			// Our values whose key is not in x. O(n + m), or O(n log m) if we are much smaller
+			set set_difference(const set& x) const
+			{
+				set ret(this->key_comp(), this->_alloc);
+
+				this->_tree.setDifference(x._tree, ret._tree);
+				return (ret);
 			}
-			
-			// Returns a range that includes all elements with a key == k
-			// Since map has unique keys, the range is at most 1 long
-			/* The function returns a pair, whose member pair::first is the lower bound of the range (the same as lower_bound),
-			   and pair::second is the upper bound (the same as upper_bound). */
-			ft::pair<iterator, iterator> equal_range(const key_type& k)
-			{ return (ft::make_pair(this->lower_bound(k), this->upper_bound(k))); }
 
-			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
-			{ return (ft::make_pair(this->lower_bound(k), this->upper_bound(k))); }
-	
-			/********** Allocator **********/
-			// Will copy since it doesn't return by reference
-			allocator_type get_allocator() const { return (this->_alloc); }
+			/* Move the values of x whose key is not in this set here, the others stay in x (like C++17 std::set::merge).
+			   Nodes are relinked, never copied nor reallocated, iterators to them stay valid but now belong to this set */
+			void merge(set& x) { this->_tree.merge(x._tree); }
+
+			/********** Comparison counter (not in std) **********/
+			// Comparator calls made by this set, only counted when FT_COUNT_COMPARISONS is defined before including it
+			size_type comparisons() const { return (this->_tree.comparisons()); }
+
+			void reset_comparisons() { this->_tree.resetComparisons(); }
 	};
 
 	/********** Non-member overloads **********/
@@ -18,6 +18,8 @@
 namespace ft
 {
 
+	/* The default vector grows with ft::default_growth<T>'s policy, specialize it to change it, or give a
+	   ft::vector<T, std::allocator<T>, Policy> as Container (see growth_policy.hpp) */
 	template < class T, class Container = ft::vector<T> >
 	class stack
 	{
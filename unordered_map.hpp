@@ -0,0 +1,274 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+#include "pairs.hpp"
+#include "hash.hpp"
+#include "HashTable.hpp"
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+namespace ft
+{
+	/* Same interface as std::unordered_map (C++11), for when keys don't need any order.
+	   Stored in an open addressing table (see HashTable.hpp), so find / count / operator[] are O(1) on average
+	   instead of a O(log n) descent. Inserting may rehash and invalidate iterators, erasing never does (but the erased one).
+	   Buckets are the table's slots, so there are no bucket iterators (bucket(), bucket_size(), begin(n)...) */
+	template <class Key,
+			  class T,
+			  class Hash = ft::hash<Key>,
+			  class Pred = std::equal_to<Key>,
+			  class Alloc = std::allocator<ft::pair<const Key, T> >
+			 >
+	class unordered_map
+	{
+		public:
+			typedef Key										key_type;
+			typedef T										mapped_type;
+			typedef ft::pair<const key_type, mapped_type>	value_type;
+
+			typedef Hash									hasher;
+			typedef Pred									key_equal;
+			typedef Alloc									allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef HashTable<key_type, value_type, ft::select_first<value_type>, hasher, key_equal, allocator_type> table_type;
+
+		public:
+			typedef typename table_type::iterator		iterator;
+			typedef typename table_type::const_iterator	const_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+		private:
+			allocator_type	_alloc; // Hash and Pred live in the table
+			table_type		_table;
+
+		public:
+			// Default constructor / empty, n is the number of values to make room for
+			explicit unordered_map(size_type n = 0,
+								   const hasher& hf = hasher(),
+								   const key_equal& eql = key_equal(),
+								   const allocator_type& alloc = allocator_type())
+								   : _alloc(alloc), _table(n, hf, eql, alloc) { }
+
+			// Range constructor
+			template <class InputIterator>
+			unordered_map(InputIterator first, InputIterator last,
+						  size_type n = 0,
+						  const hasher& hf = hasher(),
+						  const key_equal& eql = key_equal(),
+						  const allocator_type& alloc = allocator_type())
+						  : _alloc(alloc), _table(n, hf, eql, alloc)
+			{ this->_table.insertRange(first, last); }
+
+			// Copy constructor, deep copy table
+			unordered_map(const unordered_map& x) : _alloc(x._alloc), _table(x._table) { }
+
+			// Assignation operator
+			unordered_map& operator=(const unordered_map& x)
+			{
+				this->_alloc = x._alloc;
+				this->_table = x._table;
+
+				return (*this);
+			}
+
+			/********** Iterators **********/
+			iterator		begin() { return (this->_table.begin()); }
+			const_iterator	begin() const { return (this->_table.begin()); }
+
+			iterator		end() { return (this->_table.end()); }
+			const_iterator	end() const { return (this->_table.end()); }
+
+			/********** Capacity **********/
+			bool empty() const { return (this->_table.empty()); }
+			size_type size() const { return (this->_table.size()); }
+			size_type max_size() const { return (this->_table.max_size()); }
+
+			/********** Modifiers **********/
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<size_type, bool> ret = this->_table.insertUnique(val);
+				return (ft::make_pair(this->_table.at(ret.first), ret.second));
+			}
+
+			// Hint is useless here, the hash tells where to look
+			iterator insert(const_iterator position, const value_type& val)
+			{
+				(void)position;
+				return (this->_table.at(this->_table.insertUnique(val).first));
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{ this->_table.insertRange(first, last); }
+
+			size_type erase(const key_type& k) { return (this->_table.remove(k)); }
+
+			// Erasing doesn't move anything, so the next element is found from the erased one
+			iterator erase(const_iterator position)
+			{
+				size_type idx = this->_table.indexOf(position);
+
+				this->_table.removeAt(idx);
+				return (this->_table.at(idx).skipFree());
+			}
+
+			// Same, first can walk to last. Returns last
+			iterator erase(const_iterator first, const_iterator last)
+			{
+				while (first != last)
+					this->_table.removeAt(this->_table.indexOf(first++));
+				return (this->_table.at(this->_table.indexOf(last)));
+			}
+
+			void swap(unordered_map& x)
+			{
+				allocator_type tmp_alloc = this->_alloc;
+
+				this->_alloc = x._alloc;
+				x._alloc = tmp_alloc;
+
+				this->_table.swap(x._table); // Swaps Hash and Pred too
+			}
+
+			// Keeps the buckets
+			void clear() { this->_table.clear(); }
+
+			/********** Element accesses **********/
+			// Only build the pair (and mapped_type()) when the key is not there
+			mapped_type& operator[](const key_type& k)
+			{
+				size_type h;
+				ft::pair<size_type, bool> slot = this->_table.findOrInsertSlot(k, h);
+
+				if (!slot.second)
+					slot.first = this->_table.insertAt(slot.first, h, value_type(k, mapped_type()));
+				return (this->_table.at(slot.first)->second);
+			}
+
+			mapped_type& at(const key_type& k)
+			{
+				iterator it = this->find(k);
+
+				if (it == this->end())
+					throw (std::out_of_range("key is not in the map"));
+				return (it->second);
+			}
+
+			const mapped_type& at(const key_type& k) const
+			{
+				const_iterator it = this->find(k);
+
+				if (it == this->end())
+					throw (std::out_of_range("key is not in the map"));
+				return (it->second);
+			}
+
+			/********** Lookup **********/
+			// search gives bucketCount() when k is not there, which is end()
+			iterator find(const key_type& k) { return (this->_table.at(this->_table.search(k))); }
+			const_iterator find(const key_type& k) const { return (this->_table.at(this->_table.search(k))); }
+
+			size_type count(const key_type& k) const
+			{
+				if (this->_table.search(k) != this->_table.bucketCount())
+					return (1);
+				return (0);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k)
+			{
+				iterator first = this->find(k);
+				iterator last = first;
+
+				if (last != this->end())
+					++last;
+				return (ft::make_pair(first, last));
+			}
+
+			ft::pair<const_iterator, const_iterator> equal_range(const key_type& k) const
+			{
+				const_iterator first = this->find(k);
+				const_iterator last = first;
+
+				if (last != this->end())
+					++last;
+				return (ft::make_pair(first, last));
+			}
+
+			/********** Buckets / Hash policy **********/
+			size_type bucket_count() const { return (this->_table.bucketCount()); }
+
+			float load_factor() const
+			{
+				if (this->bucket_count() == 0)
+					return (0.0f);
+				return (static_cast<float>(this->size()) / static_cast<float>(this->bucket_count()));
+			}
+
+			// Fixed, the table relies on it to always have empty slots
+			float max_load_factor() const { return (table_type::maxLoadFactor()); }
+
+			void rehash(size_type n) { this->_table.rehash(n); }
+
+			void reserve(size_type n) { this->_table.reserve(n); }
+
+			/********** Observers **********/
+			hasher hash_function() const { return (this->_table.hash_function()); }
+
+			key_equal key_eq() const { return (this->_table.key_eq()); }
+
+			/********** Allocator **********/
+			allocator_type get_allocator() const { return (this->_alloc); }
+	};
+
+	/********** Non-member overloads **********/
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	void swap(ft::unordered_map<Key, T, Hash, Pred, Alloc>& x, ft::unordered_map<Key, T, Hash, Pred, Alloc>& y)
+	{ x.swap(y); }
+
+	// Orders differ, so look each of lhs up in rhs
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator==(const ft::unordered_map<Key, T, Hash, Pred, Alloc>& lhs,
+					const ft::unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (typename ft::unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			typename ft::unordered_map<Key, T, Hash, Pred, Alloc>::const_iterator found = rhs.find(it->first);
+
+			if (found == rhs.end() || !(found->second == it->second))
+				return (false);
+		}
+		return (true);
+	}
+
+	template <class Key, class T, class Hash, class Pred, class Alloc>
+	bool operator!=(const ft::unordered_map<Key, T, Hash, Pred, Alloc>& lhs,
+					const ft::unordered_map<Key, T, Hash, Pred, Alloc>& rhs)
+	{ return (!(lhs == rhs)); }
+}
+
+#endif
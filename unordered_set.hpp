@@ -0,0 +1,223 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                  .-.                       .               */
+/*                                 / -'                      /                */
+/*                  .  .-. .-.   -/--).--..-.  .  .-. .-.   /-.  .-._.)  (    */
+/*   By:             )/   )   )  /  /    (  |   )/   )   ) /   )(   )(    )   */
+/*                  '/   /   (`.'  /      `-'-''/   /   (.'`--'`-`-'  `--':   */
+/*   Created: 17-10-2026  by  `-'                        `-'                  */
+/*   Updated: 17-10-2026 18:10 by                                             */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef UNORDERED_SET_HPP
+# define UNORDERED_SET_HPP
+
+#include "pairs.hpp"
+#include "hash.hpp"
+#include "HashTable.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace ft
+{
+	/* Same interface as std::unordered_set (C++11), same table as ft::unordered_map (see there) */
+	template <class Key,
+			  class Hash = ft::hash<Key>,
+			  class Pred = std::equal_to<Key>,
+			  class Alloc = std::allocator<Key>
+			 >
+	class unordered_set
+	{
+		public:
+			typedef Key		key_type;
+			typedef Key		value_type;
+
+			typedef Hash									hasher;
+			typedef Pred									key_equal;
+			typedef Alloc									allocator_type;
+
+			typedef typename allocator_type::reference			reference;
+			typedef typename allocator_type::const_reference	const_reference;
+			typedef typename allocator_type::pointer			pointer;
+			typedef typename allocator_type::const_pointer		const_pointer;
+
+		private:
+			typedef HashTable<key_type, value_type, ft::identity<value_type>, hasher, key_equal, allocator_type> table_type;
+
+		public:
+			// Values are const in a set, so both are the const_iterator
+			typedef typename table_type::const_iterator	iterator;
+			typedef typename table_type::const_iterator	const_iterator;
+
+			typedef ptrdiff_t	difference_type;
+			typedef size_t		size_type;
+
+		private:
+			allocator_type	_alloc; // Hash and Pred live in the table
+			table_type		_table;
+
+		public:
+			// Default constructor / empty, n is the number of values to make room for
+			explicit unordered_set(size_type n = 0,
+								   const hasher& hf = hasher(),
+								   const key_equal& eql = key_equal(),
+								   const allocator_type& alloc = allocator_type())
+								   : _alloc(alloc), _table(n, hf, eql, alloc) { }
+
+			// Range constructor
+			template <class InputIterator>
+			unordered_set(InputIterator first, InputIterator last,
+						  size_type n = 0,
+						  const hasher& hf = hasher(),
+						  const key_equal& eql = key_equal(),
+						  const allocator_type& alloc = allocator_type())
+						  : _alloc(alloc), _table(n, hf, eql, alloc)
+			{ this->_table.insertRange(first, last); }
+
+			// Copy constructor, deep copy table
+			unordered_set(const unordered_set& x) : _alloc(x._alloc), _table(x._table) { }
+
+			// Assignation operator
+			unordered_set& operator=(const unordered_set& x)
+			{
+				this->_alloc = x._alloc;
+				this->_table = x._table;
+
+				return (*this);
+			}
+
+			/********** Iterators **********/
+			iterator	begin() const { return (this->_table.begin()); }
+			iterator	end() const { return (this->_table.end()); }
+
+			/********** Capacity **********/
+			bool empty() const { return (this->_table.empty()); }
+			size_type size() const { return (this->_table.size()); }
+			size_type max_size() const { return (this->_table.max_size()); }
+
+			/********** Modifiers **********/
+			ft::pair<iterator, bool> insert(const value_type& val)
+			{
+				ft::pair<size_type, bool> ret = this->_table.insertUnique(val);
+				return (ft::make_pair(iterator(this->_table.at(ret.first)), ret.second));
+			}
+
+			// Hint is useless here, the hash tells where to look
+			iterator insert(const_iterator position, const value_type& val)
+			{
+				(void)position;
+				return (iterator(this->_table.at(this->_table.insertUnique(val).first)));
+			}
+
+			template <class InputIterator>
+			void insert(InputIterator first, InputIterator last)
+			{ this->_table.insertRange(first, last); }
+
+			size_type erase(const key_type& k) { return (this->_table.remove(k)); }
+
+			// Erasing doesn't move anything, so the next element is found from the erased one
+			iterator erase(const_iterator position)
+			{
+				size_type idx = this->_table.indexOf(position);
+
+				this->_table.removeAt(idx);
+				return (iterator(this->_table.at(idx)).skipFree());
+			}
+
+			// Same, first can walk to last. Returns last
+			iterator erase(const_iterator first, const_iterator last)
+			{
+				while (first != last)
+					this->_table.removeAt(this->_table.indexOf(first++));
+				return (last);
+			}
+
+			void swap(unordered_set& x)
+			{
+				allocator_type tmp_alloc = this->_alloc;
+
+				this->_alloc = x._alloc;
+				x._alloc = tmp_alloc;
+
+				this->_table.swap(x._table); // Swaps Hash and Pred too
+			}
+
+			// Keeps the buckets
+			void clear() { this->_table.clear(); }
+
+			/********** Lookup **********/
+			// search gives bucketCount() when k is not there, which is end()
+			iterator find(const key_type& k) const { return (this->_table.at(this->_table.search(k))); }
+
+			size_type count(const key_type& k) const
+			{
+				if (this->_table.search(k) != this->_table.bucketCount())
+					return (1);
+				return (0);
+			}
+
+			ft::pair<iterator, iterator> equal_range(const key_type& k) const
+			{
+				iterator first = this->find(k);
+				iterator last = first;
+
+				if (last != this->end())
+					++last;
+				return (ft::make_pair(first, last));
+			}
+
+			/********** Buckets / Hash policy **********/
+			size_type bucket_count() const { return (this->_table.bucketCount()); }
+
+			float load_factor() const
+			{
+				if (this->bucket_count() == 0)
+					return (0.0f);
+				return (static_cast<float>(this->size()) / static_cast<float>(this->bucket_count()));
+			}
+
+			// Fixed, the table relies on it to always have empty slots
+			float max_load_factor() const { return (table_type::maxLoadFactor()); }
+
+			void rehash(size_type n) { this->_table.rehash(n); }
+
+			void reserve(size_type n) { this->_table.reserve(n); }
+
+			/********** Observers **********/
+			hasher hash_function() const { return (this->_table.hash_function()); }
+
+			key_equal key_eq() const { return (this->_table.key_eq()); }
+
+			/********** Allocator **********/
+			allocator_type get_allocator() const { return (this->_alloc); }
+	};
+
+	/********** Non-member overloads **********/
+	template <class Key, class Hash, class Pred, class Alloc>
+	void swap(ft::unordered_set<Key, Hash, Pred, Alloc>& x, ft::unordered_set<Key, Hash, Pred, Alloc>& y)
+	{ x.swap(y); }
+
+	// Orders differ, so look each of lhs up in rhs
+	template <class Key, class Hash, class Pred, class Alloc>
+	bool operator==(const ft::unordered_set<Key, Hash, Pred, Alloc>& lhs,
+					const ft::unordered_set<Key, Hash, Pred, Alloc>& rhs)
+	{
+		if (lhs.size() != rhs.size())
+			return (false);
+		for (typename ft::unordered_set<Key, Hash, Pred, Alloc>::const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+		{
+			if (rhs.find(*it) == rhs.end())
+				return (false);
+		}
+		return (true);
+	}
+
+	template <class Key, class Hash, class Pred, class Alloc>
+	bool operator!=(const ft::unordered_set<Key, Hash, Pred, Alloc>& lhs,
+					const ft::unordered_set<Key, Hash, Pred, Alloc>& rhs)
+	{ return (!(lhs == rhs)); }
+}
+
+#endif
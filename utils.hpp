@@ -40,6 +40,34 @@ namespace ft
 	template<class T>
 	struct is_same<T, T> { static const bool value = true; };
 
+
+	// Key of value functors, tell a tree how to get the key of the values it stores
+
+	// Value is it's own key (eg. set)
+	template <class T>
+	struct identity
+	{
+		const T& operator()(const T& x) const { return (x); }
+	};
+
+	// Key is the first member of the pair (eg. map)
+	template <class Pair>
+	struct select_first
+	{
+		const typename Pair::first_type& operator()(const Pair& x) const { return (x.first); }
+
+		// Other pairs (eg. ft::pair<int, int> for a ft::pair<const int, int>) would be copied to Pair otherwise
+		template <class OtherPair>
+		const typename OtherPair::first_type& operator()(const OtherPair& x) const { return (x.first); }
+	};
+
+
+	// Tag telling a container the given range is already sorted and has no duplicates, so it doesn't need to check
+	struct sorted_unique_t { };
+
+	// Eg. 'ft::map<int, int> m(ft::sorted_unique, v.begin(), v.end());'
+	const sorted_unique_t sorted_unique = sorted_unique_t();
+
 }
 
 #endif
\ No newline at end of file
@@ -17,20 +17,26 @@
 #include "enable_if.hpp"
 #include "comparisons.hpp"
 #include "VectorIterator.hpp"
+#include "is_trivially_relocatable.hpp"
+#include "mmap_allocator.hpp"
+#include "growth_policy.hpp"
 
 #include <memory>
+#include <cstring>
 #include <stdexcept>
 #include <limits>
 
 namespace ft
 {	// > > instead of >> because otherwise C++ might think it's a bitshift
-	template <class T, class Allocator = std::allocator<T> >
+	/* Growth is how much the vector grows when it's full, see growth_policy.hpp */
+	template <class T, class Allocator = std::allocator<T>, class Growth = typename ft::default_growth<T>::type>
 	class vector
 	{
 		/* IMO typedefs first, then pivate members, then public */
 		public:
 			typedef T											value_type;
 			typedef Allocator									allocator_type;
+			typedef Growth										growth_policy;
 			/* All of these could be used with value_type for the default allocator, but maybe not custom ones */
 			typedef typename allocator_type::reference			reference; /* Same as value_type& */
 			typedef typename allocator_type::const_reference	const_reference; /* Same as const value_type& */
@@ -54,61 +60,176 @@ namespace ft
 			size_type		_capacity;
 			allocator_type	_alloc;
 
-			/* Like std::distance but worse.
-			   Actual point is because the std version does not work with ft::<any_iterator>_tag */
+			/* Ranges are dispatched on their category (see ft::iterator_category_of), forward iterators and better are
+			   counted first so we know how much room to make, single pass ones can only be read once */
+
+			// Grow as we go, like push_back
+			template <class InputIterator>
+			void assignRange(InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				this->clear();
+				for (; first != last; ++first)
+					this->push_back(*first);
+			}
+
+			template <class ForwardIterator>
+			void assignRange(ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n = ft::distance(first, last); // O(1) for random access
+
+				this->clear();
+				this->reserve(n);
+				for (; first != last; ++first, ++this->_size)
+					this->_alloc.construct(this->_ptr + this->_size, *first);
+			}
+
+			// Can't count without reading them, so read them in a vector first, which can be counted
 			template <class InputIterator>
-			typename ft::iterator_traits<InputIterator>::difference_type
-			distance(InputIterator first, InputIterator last)
+			void insertRange(size_type index, InputIterator first, InputIterator last, ft::input_iterator_tag)
+			{
+				vector tmp(first, last, this->_alloc);
+
+				this->insertRange(index, tmp.begin(), tmp.end(), ft::random_access_iterator_tag());
+			}
+
+			template <class ForwardIterator>
+			void insertRange(size_type index, ForwardIterator first, ForwardIterator last, ft::forward_iterator_tag)
+			{
+				size_type n = ft::distance(first, last);
+
+				this->moveElementsRight(index, n);
+
+				// Fill the "blank" slots
+				for (pointer slot = this->_ptr + index; first != last; ++first, ++slot)
+					this->_alloc.construct(slot, *first);
+				this->_size += n;
+			}
+
+			/* With an allocator that can resize a block in place (see mmap_allocator.hpp), a vector of trivially relocatable
+			   values never copies itself to grow: the block is resized and the bytes follow (with mremap, the pages do) */
+			typedef typename ft::choose<ft::is_trivially_relocatable<value_type>::value && ft::is_remappable_allocator<allocator_type>::value,
+										ft::true_type, ft::false_type>::type can_remap;
+
+			// Capacity becomes capacity (bigger), elements are kept
+			void grow(size_type capacity, ft::true_type)
 			{
-				size_type i = 0;
-				while (first++ != last)
-					++i;
-				return (i);
+				this->_ptr = this->_alloc.reallocate(this->_ptr, this->_capacity, capacity);
+				this->_capacity = capacity;
+			}
+
+			void grow(size_type capacity, ft::false_type)
+			{
+				pointer tmp = this->_alloc.allocate(capacity);
+				this->relocate(tmp, this->_ptr, this->_size); /* Move content, old elements are destroyed */
+				this->_alloc.deallocate(this->_ptr, this->_capacity);
+				this->_ptr = tmp;
+				this->_capacity = capacity;
+			}
+
+			// Capacity to grow to when we need room for required values, as the policy says but never less than required
+			size_type nextCapacity(size_type required) const
+			{
+				size_type capacity = growth_policy::next(this->_capacity, required, sizeof(value_type));
+
+				if (capacity > this->max_size())
+					capacity = this->max_size();
+				return ((capacity < required) ? required : capacity);
+			}
+
+			/* Slots [size, oldSize) are not used anymore, the allocator may give their memory back (capacity doesn't change).
+			   Slots after oldSize were already given back (or never used), so each page is released once */
+			void releaseUnused(size_type oldSize, ft::true_type) { this->_alloc.release(this->_ptr, this->_size, oldSize); }
+			void releaseUnused(size_type, ft::false_type) { }
+
+			// Every shrink from the end (resize, pop_back, clear) goes through here: elements from n on are destroyed
+			void destroyTail(size_type n)
+			{
+				size_type oldSize = this->_size;
+
+				for (size_type i = n; i < oldSize; ++i)
+					this->_alloc.destroy(this->_ptr + i);
+				this->_size = n;
+				this->releaseUnused(oldSize, ft::is_remappable_allocator<allocator_type>());
+			}
+
+			/* Move n elements from src to dst (ranges may overlap), as in construct each at it's new place and destroy the old one.
+			   Trivially relocatable types (see is_trivially_relocatable.hpp) are moved as bytes, all at once */
+			void relocate(pointer dst, pointer src, size_type n)
+			{ this->relocate(dst, src, n, ft::is_trivially_relocatable<value_type>()); }
+
+			void relocate(pointer dst, pointer src, size_type n, ft::true_type)
+			{
+				if (n == 0 || dst == src)
+					return ;
+				if (dst + n <= src || src + n <= dst) // Not overlapping, eg. to a new buffer
+					std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+				else
+					std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(value_type));
+			}
+
+			void relocate(pointer dst, pointer src, size_type n, ft::false_type)
+			{
+				if (dst == src)
+					return ;
+				// Going left start from the first one, going right from the last one, so we never write over one not moved yet
+				if (dst < src)
+				{
+					for (size_type i = 0; i < n; ++i)
+					{
+						this->_alloc.construct(dst + i, src[i]);
+						this->_alloc.destroy(src + i);
+					}
+				}
+				else
+				{
+					for (size_type i = n; i > 0; --i)
+					{
+						this->_alloc.construct(dst + i - 1, src[i - 1]);
+						this->_alloc.destroy(src + i - 1);
+					}
+				}
 			}
 
 			// Move elements distance away (to the right) starting at index (included), DOES NOT modify size
 			// Vector = 1, 2, 3, 4, 5 moveElementsRight(2, 5) => 1, 2, -, -, -, -, -, 3, 4, 5 
 			void moveElementsRight(size_type index, size_type distance)
 			{
-				if (this->_capacity == 0)
-					this->reserve(1);
-
-				// Since we don't know the final size, use while loop
-				while (this->_size + distance > this->_capacity)
-					this->reserve(this->_capacity * 2);
-
-				// From end to start because otherwise we modify the next slot we are going to copy
-				// Eg. copy 0 to 1, then copy 1 to 2 would cause 0 = 1 = 2
-				// If distance is 0, we copy to the same slot then delete, to avoid that check first
-				if (this->_size == 0 || distance == 0)
+				if (distance == 0)
 					return ;
+				if (this->_size + distance > this->max_size())
+					throw (std::length_error("insert: too many elements"));
 
-				for (size_type i = this->_size - 1; i >= index; --i)
+				if (this->_size + distance > this->_capacity)
 				{
-					this->_alloc.construct(this->_ptr + i + distance, this->_ptr[i]); // Copy the value distance slots away
-					this->_alloc.destroy(this->_ptr + i); // Destroy the original value
-					// Repeat
-					if (i == 0) // If i == 0 and index is 0, manually break otherwise i would overflow next iteration
+					size_type capacity = this->nextCapacity(this->_size + distance);
+
+					// Nothing is copied to grow, then only the elements after index move, same as if we had room
+					if (can_remap::value)
+						this->grow(capacity, can_remap());
+					else
+					{
+						// Elements before and after index go straight to their final place in the new buffer, each moved once
+						pointer tmp = this->_alloc.allocate(capacity);
+						this->relocate(tmp, this->_ptr, index);
+						this->relocate(tmp + index + distance, this->_ptr + index, this->_size - index);
+						this->_alloc.deallocate(this->_ptr, this->_capacity);
+						this->_ptr = tmp;
+						this->_capacity = capacity;
 						return ;
+					}
 				}
+
+				if (index < this->_size)
+					this->relocate(this->_ptr + index + distance, this->_ptr + index, this->_size - index);
 			}
 
 			// Move elements distance away (to the left) starting at index (excluded), DOES NOT modify size
 			// Vector = 1, 2, 3, 4, 5 moveElementsLeft(0, 1) => 2, 3, 4, 5, -
 			void moveElementsLeft(size_type index, size_type distance)
 			{
-				// From start because otherwise we modify the next slot we are going to copy
-				// Eg. copy 2 to 1, then copy 1 to 0 would cause 2 = 1 = 0
-				// If distance is 0, we copy to the same slot then delete, to avoid that check first
-				if (this->_size == 0 || distance == 0)
+				if (index + distance >= this->_size || distance == 0)
 					return ;
-
-				for (size_type i = index; i + distance < this->_size; ++i)
-				{
-					this->_alloc.construct(this->_ptr + i, this->_ptr[i + distance]); // Copy the value from distance slots away
-					this->_alloc.destroy(this->_ptr + i + distance); // Destroy the original value
-					// Repeat
-				}
+				this->relocate(this->_ptr + index, this->_ptr + index + distance, this->_size - index - distance);
 			}
 
 
@@ -136,7 +257,7 @@ namespace ft
 			/* Copy constructor */
 			vector(const vector& x) : _ptr(0), _size(0), _capacity(0), _alloc(x.get_allocator())
 			{
-				this->resize(x._size); /* First resize to initialize capacity and size */				
+				this->reserve(x._size); /* Only make room, elements are copy constructed right after */
 				
 				for (size_type i = 0; i < x._size; ++i)
 					this->_alloc.construct(this->_ptr + i, x._ptr[i]);
@@ -180,30 +301,15 @@ namespace ft
 					throw (std::length_error("resize: value requested too big"));
 				if (n > this->_size)
 				{
-					if (n > this->_capacity) /* Realloc of size n */
-					{
-						pointer tmp = this->_alloc.allocate(n);
-						for (size_type i = 0; i < this->_size; ++i) /* Move content */
-							this->_alloc.construct(tmp + i, this->_ptr[i]);
-						for (size_type i = this->_size; i < n; ++i) /* Append new content */
-							this->_alloc.construct(tmp + i, val);
-						this->_alloc.deallocate(this->_ptr, this->_capacity);
-						this->_ptr = tmp;
-						this->_capacity = n;
-						this->_size = n;
-					}
-					else /* Append without realloc */
-					{
-						for (size_type i = this->_size; i < n; ++i)
-							this->_alloc.construct(this->_ptr + i, val);
-					}
+					this->reserve(n); /* Realloc of size n if needed */
+					for (size_type i = this->_size; i < n; ++i) /* Append new content */
+						this->_alloc.construct(this->_ptr + i, val);
 				}
 				else
 				{
-					this->_size = n;
-					/* If n is smaller than the current container size, the content is reduced to its first n elements, removing those beyond (and destroying them). */
-					for (size_type i = n; i < this->_capacity; ++i)
-						this->_alloc.destroy(this->_ptr + i);
+					/* If n is smaller than the current container size, the content is reduced to its first n elements, removing those beyond (and destroying them).
+					   Slots after size were never constructed, so stop there */
+					this->destroyTail(n);
 				}
 				this->_size = n;
 			}
@@ -216,13 +322,7 @@ namespace ft
 			{
 				if (n <= this->_capacity)
 					return;
-				
-				pointer tmp = this->_alloc.allocate(n);
-				for (size_type i = 0; i < this->_size; ++i) /* Move content */
-				 	this->_alloc.construct(tmp + i, this->_ptr[i]);
-				this->_alloc.deallocate(this->_ptr, this->_capacity);
-				this->_ptr = tmp;
-				this->_capacity = n;
+				this->grow(n, can_remap());
 			}
 
 			reference		operator[](size_type n) { return (*(this->_ptr + n)); }
@@ -274,24 +374,17 @@ namespace ft
 			   including the element pointed by first but not the element pointed by last  */
 			template <class InputIterator>
 			void	assign(InputIterator first, typename ft::enable_if<!std::numeric_limits<InputIterator>::is_integer ,InputIterator>::type last)
-			{
-				this->reserve(this->distance(first, last));
-				for (size_type i = 0; i < this->_size; ++i)
-					this->_alloc.destroy(this->_ptr + i);
-				
-				this->_size = this->distance(first, last); // Set distance first since we modify first after
-
-				for (size_type i = 0; first != last; ++first, ++i)
-					this->_alloc.construct(this->_ptr + i, *first);
-			}
+			{ this->assignRange(first, last, ft::iterator_category_of(first)); }
 
-			/* If the array is not enough to hold value, double it's size */
+			/* If the array is not enough to hold value, grow it (double it's size by default, see growth_policy.hpp) */
 			void	push_back(const value_type& val)
 			{
-				if (this->_capacity == 0)
-					this->reserve(1);
-				else if (this->_size + 1 > this->_capacity)
-					this->reserve(this->_capacity * 2);
+				// Growing goes through insert, which also takes care of val being one of ours
+				if (this->_size == this->_capacity)
+				{
+					this->insert(this->end(), 1, val);
+					return;
+				}
 
 				this->_alloc.construct(this->_ptr + this->_size, val); /* this->_size = one after last element */
 				++this->_size;
@@ -299,38 +392,37 @@ namespace ft
 
 			void	pop_back()
 			{
-				this->_alloc.destroy(this->_ptr + this->_size - 1);
-				--this->_size;
+				this->destroyTail(this->_size - 1);
 			}
 
 			/* Returns an iterator pointing to first new elt to check iterator invalidion (partial or total), if return value == position, everything before position is still valid,
 			   otherwise not, if it's != all iterators are invalidated */
 			iterator insert(iterator position, const value_type& val)
 			{
-				size_type index = this->distance(this->begin(), position);
+				size_type index = ft::distance(this->begin(), position);
 
-				// Move everything one slot to the right, starting at index
-				this->moveElementsRight(index, 1);
-
-				// Set the one value at index
-				this->_alloc.construct(this->_ptr + index, val);
-				++this->_size;
+				this->insert(position, 1, val);
 				return (iterator(this->_ptr + index));
 			}
 
 			void insert(iterator position, size_type n, const value_type& val)
 			{
-				size_type index = this->distance(this->begin(), position);
+				// val may be one of ours, which is moved (or freed) when making room, so copy it first
+				if (&val >= this->_ptr && &val < this->_ptr + this->_size)
+				{
+					value_type copy(val);
+					return (this->insert(position, n, copy));
+				}
+
+				size_type index = ft::distance(this->begin(), position);
 
-				// Same as above, except we move n instead of 1
 				this->moveElementsRight(index, n);
 
-				// Fill the "blank" slots
-				for (size_type i = 0; i < n; ++i)
-				{
-					this->_alloc.construct(this->_ptr + index + i, val);
-					++this->_size;
-				}
+				// Fill the "blank" slots, size only once done so the loop doesn't write it back every time
+				pointer slot = this->_ptr + index;
+				for (pointer end = slot + n; slot != end; ++slot)
+					this->_alloc.construct(slot, val);
+				this->_size += n;
 			}
 
 			// Same as above, except now N is the distance between first and last
@@ -340,39 +432,23 @@ namespace ft
 			   which makes is_integer (which fortunately is C++98) a perfect choice */
 			template<class InputIterator>
 			void insert(iterator position, InputIterator first, typename ft::enable_if<!std::numeric_limits<InputIterator>::is_integer ,InputIterator>::type last)
-			{
-				size_type index = this->distance(this->begin(), position);
-				size_type n = 0;
-
-				InputIterator firstCpy(first);
-				while (firstCpy++ != last)
-					++n;
-
-				this->moveElementsRight(index, n);
-
-				// Fill the "blank" slots
-				for(size_type i = 0; first != last; ++i)
-				{
-					this->_alloc.construct(this->_ptr + index + i, *first);
-					++first;
-					++this->_size;
-				}
-			}
+			{ this->insertRange(ft::distance(this->begin(), position), first, last, ft::iterator_category_of(first)); }
 
 			iterator erase(iterator position)
 			{
 				if (this->_size == 0)
 					return (this->end());
 					
-				size_type index = this->distance(this->begin(), position);
+				size_type index = ft::distance(this->begin(), position);
 
 				// Destroy the given element
 				this->_alloc.destroy(this->_ptr + index);
 
-				// Shift everything left
+				// Shift everything left, the last slot is left empty
 				this->moveElementsLeft(index, 1);
 				
 				--this->_size;
+				this->releaseUnused(this->_size + 1, ft::is_remappable_allocator<allocator_type>());
 				return (iterator(this->_ptr + index)); // Since we removed element at index, returning ptr + index returns the one following the deleted element
 			}
 
@@ -380,8 +456,8 @@ namespace ft
 			// 1
 			iterator erase(iterator first, iterator last)
 			{
-				size_type index = this->distance(this->begin(), first);
-				size_type n = this->distance(first, last);
+				size_type index = ft::distance(this->begin(), first);
+				size_type n = ft::distance(first, last);
 
 				if (index >= this->_size) // past the end or equal
 					return (this->end());
@@ -392,75 +468,77 @@ namespace ft
 				for (size_type i = index; i < index + n; ++i)
 					this->_alloc.destroy(this->_ptr + i);
 
-				// Shift everything left
+				// Shift everything left, the last n slots are left empty
 				this->moveElementsLeft(index, n);
 
 				this->_size -= n;
+				this->releaseUnused(this->_size + n, ft::is_remappable_allocator<allocator_type>());
 				return (iterator(this->_ptr + index)); /* Since we removed element at index, returning ptr + index returns the one following the deleted element */
 			}
 
 			void swap(vector& x)
 			{
-				pointer		tmp_ptr = this->_ptr;
-				size_type	tmp_size = this->_size;
-				size_type	tmp_capacity = this->_capacity;
+				pointer			tmp_ptr = this->_ptr;
+				size_type		tmp_size = this->_size;
+				size_type		tmp_capacity = this->_capacity;
+				allocator_type	tmp_alloc = this->_alloc; // Memory goes back to the allocator that gave it
 
 				this->_ptr = x._ptr;
 				this->_size = x._size;
 				this->_capacity = x._capacity;
+				this->_alloc = x._alloc;
 
 				x._ptr = tmp_ptr;
 				x._size = tmp_size;
 				x._capacity = tmp_capacity;
+				x._alloc = tmp_alloc;
 			}
 
 			/* deallocate does not destroy elements, see std::allocator::deallocate cplusplus.com */
 			void clear()
 			{
-				for (size_type i = 0; i < this->_size; ++i)
-					this->_alloc.destroy(this->_ptr + i);
-				this->_size = 0;
+				this->destroyTail(0);
 			}
 
 			allocator_type get_allocator() const
 			{
-				return (allocator_type());
+				return (this->_alloc);
 			}
 	};
 
 	/* Should be optimized, but who cares */
-	template <class T, class Alloc>
-	void swap(ft::vector<T,Alloc>& x, ft::vector<T,Alloc>& y)
+	template <class T, class Alloc, class Growth>
+	void swap(ft::vector<T,Alloc,Growth>& x, ft::vector<T,Alloc,Growth>& y)
 	{ x.swap(y); }
 
 	/* We are not forced to write template arguments since compiler template
 	   deduction does it automatically */
-	template <class T, class Alloc>
-	bool operator==(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator==(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{
 		if (lhs.size() != rhs.size())
 			return (false);
 		return (ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 	}
 
-	template <class T, class Alloc>
-	bool operator!=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator!=(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{ return (!(lhs == rhs)); }
 
-	template <class T, class Alloc>
-	bool operator<(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator<(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{ return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end())); }
 
-	template <class T, class Alloc>
-	bool operator<=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator<=(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{ return (lhs < rhs || lhs == rhs); }
 
-	template <class T, class Alloc>
-	bool operator>(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator>(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{ return (!(lhs <= rhs)); } // Either <= or >
 
-	template <class T, class Alloc>
-	bool operator>=(const ft::vector<T,Alloc>& lhs, const ft::vector<T,Alloc>& rhs)
+	template <class T, class Alloc, class Growth>
+	bool operator>=(const ft::vector<T,Alloc,Growth>& lhs, const ft::vector<T,Alloc,Growth>& rhs)
 	{ return (!(lhs < rhs)); } // Either < or >=
 
 }